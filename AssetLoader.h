@@ -0,0 +1,177 @@
+#ifndef ASSET_LOADER_H
+#define ASSET_LOADER_H
+
+#include "raylib.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Refers to a file queued on an AssetLoader
+struct AssetJob {
+    int index;
+};
+
+enum AssetType { ASSET_IMAGE, ASSET_WAVE };
+
+struct AssetJobData {
+    AssetType type;
+    const char* fileName;                   // kept by pointer, pass a string literal
+    bool decoding;                          // picked by a worker (or the owning thread)
+    bool decoded;
+    bool taken;                             // result handed to the caller, no longer owned by the loader
+    Image image;
+    Wave wave;
+};
+
+// Decodes image and sound files on worker threads. Workers only run the CPU side (file read,
+// stb_image/stb_vorbis decode); the owning thread turns the results into textures and sounds,
+// which need the GL context and the audio device. Jobs can be queued before InitWindow() and
+// InitAudioDevice() so decoding overlaps opening them.
+struct AssetLoader {
+    std::vector<std::thread> workers;       // started as jobs are queued, up to maxWorkers
+    int maxWorkers;
+    std::deque<AssetJobData> jobs;          // deque keeps jobs in place while more are queued
+    std::deque<int> pending;                // jobs no worker has picked yet, in queue order
+    std::mutex mutex;
+    std::condition_variable jobQueued;
+    std::condition_variable jobDecoded;
+    bool closing;
+};
+
+inline void DecodeAssetJob(AssetJobData& job) {
+    PROFILE_SCOPE("decodeAsset");
+    if (job.type == ASSET_IMAGE) job.image = LoadImage(job.fileName);
+    else job.wave = LoadWave(job.fileName);
+}
+
+inline void RunAssetWorker(AssetLoader& loader) {
+    std::unique_lock<std::mutex> lock(loader.mutex);
+
+    while (true) {
+        loader.jobQueued.wait(lock, [&] { return loader.closing || !loader.pending.empty(); });
+        if (loader.pending.empty()) return;
+
+        int index = loader.pending.front();
+        loader.pending.pop_front();
+        loader.jobs[index].decoding = true;
+        AssetJobData job = loader.jobs[index];
+
+        lock.unlock();
+        DecodeAssetJob(job);
+        lock.lock();
+
+        loader.jobs[index].image = job.image;
+        loader.jobs[index].wave = job.wave;
+        loader.jobs[index].decoded = true;
+        loader.jobDecoded.notify_all();
+    }
+}
+
+// QueueAssetJob() starts a worker while workers.size() < min(jobs.size(), maxWorkers), so there are never
+// more workers than jobs queued or maxWorkers. With no workers every job is decoded by the owning thread when it is waited for
+inline void InitAssetLoader(AssetLoader& loader, int maxWorkers) {
+    loader.maxWorkers = std::max(0, maxWorkers);
+    loader.closing = false;
+}
+
+inline AssetJob QueueAssetJob(AssetLoader& loader, AssetType type, const char* fileName) {
+    std::lock_guard<std::mutex> lock(loader.mutex);
+    AssetJobData job = {type, fileName, false, false, false, {0}, {0}};
+    loader.jobs.push_back(job);
+    loader.pending.push_back((int)loader.jobs.size() - 1);
+
+    if ((int)loader.workers.size() < std::min((int)loader.jobs.size(), loader.maxWorkers)) {
+        loader.workers.emplace_back(RunAssetWorker, std::ref(loader));
+    }
+    loader.jobQueued.notify_one();
+    return {(int)loader.jobs.size() - 1};
+}
+
+inline AssetJob LoadImageAsync(AssetLoader& loader, const char* fileName) {
+    return QueueAssetJob(loader, ASSET_IMAGE, fileName);
+}
+
+inline AssetJob LoadWaveAsync(AssetLoader& loader, const char* fileName) {
+    return QueueAssetJob(loader, ASSET_WAVE, fileName);
+}
+
+// Polls a job without blocking
+inline bool IsAssetJobDecoded(AssetLoader& loader, AssetJob job) {
+    std::lock_guard<std::mutex> lock(loader.mutex);
+    return loader.jobs[job.index].decoded;
+}
+
+// Blocks until the job is decoded and hands its result over. A job no worker has picked yet is
+// decoded on the calling thread instead of waiting for one to free up. A job already waited for
+// returns an empty image/wave, its result belongs to the first caller
+inline AssetJobData WaitAssetJob(AssetLoader& loader, AssetJob job) {
+    std::unique_lock<std::mutex> lock(loader.mutex);
+    AssetJobData& data = loader.jobs[job.index];
+
+    if (!data.decoding) {
+        loader.pending.erase(std::find(loader.pending.begin(), loader.pending.end(), job.index));
+        data.decoding = true;
+
+        lock.unlock();
+        DecodeAssetJob(data);
+        lock.lock();
+        data.decoded = true;
+    }
+
+    loader.jobDecoded.wait(lock, [&] { return data.decoded; });
+
+    AssetJobData result = data;
+    if (data.taken) {
+        result.image = {0};
+        result.wave = {0};
+    }
+    data.taken = true;
+    return result;
+}
+
+// The caller owns the returned image (UnloadImage()), empty if the job was already waited for
+inline Image WaitImage(AssetLoader& loader, AssetJob job) {
+    return WaitAssetJob(loader, job).image;
+}
+
+// Uploads the decoded image on the calling thread, which must own the GL context
+inline Texture2D WaitTexture(AssetLoader& loader, AssetJob job) {
+    Image image = WaitImage(loader, job);
+    Texture2D texture = LoadTextureFromImage(image);
+    UnloadImage(image);
+    return texture;
+}
+
+// Creates the sound buffer from the decoded wave on the calling thread, after InitAudioDevice()
+inline Sound WaitSound(AssetLoader& loader, AssetJob job) {
+    Wave wave = WaitAssetJob(loader, job).wave;
+    Sound sound = LoadSoundFromWave(wave);
+    UnloadWave(wave);
+    return sound;
+}
+
+// Stops the workers once the queued jobs are decoded and frees the results nobody waited for
+inline void CloseAssetLoader(AssetLoader& loader) {
+    {
+        std::lock_guard<std::mutex> lock(loader.mutex);
+        loader.closing = true;
+    }
+    loader.jobQueued.notify_all();
+    for (std::thread& worker : loader.workers) worker.join();
+    loader.workers.clear();
+
+    // Without workers, jobs nobody waited for were never decoded
+    for (AssetJobData& job : loader.jobs) {
+        if (job.taken || !job.decoded) continue;
+        if (job.type == ASSET_IMAGE) UnloadImage(job.image);
+        else UnloadWave(job.wave);
+    }
+    loader.jobs.clear();
+    loader.pending.clear();
+}
+
+#endif
@@ -1,17 +1,38 @@
 #include "raylib.h"
 #include <raymath.h>
+#include <rlgl.h>
 #include <vector>
 #include <string>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include "SpatialHash.h"
+#include "Pool.h"
+#include "Profiler.h"
+#include "AssetLoader.h"
+
+#if defined(__SSE2__) || defined(__AVX__)
+    #include <immintrin.h>
+#endif
 
 const float FPS = 60;
-const float TIMESTEP = 1.0f / FPS;
+const float TIMESTEP = 1.0f / FPS;           // Every gameplay system advances in ticks of this length
+const float MAX_ACCUMULATOR = 0.1f;          // Catch-up limit, slower frames drop time instead of piling up ticks
 const float FRICTION = 0.99f;
+const int SCREEN_WIDTH = 800;
+const int SCREEN_HEIGHT = 600;
+const float GRID_CELL_SIZE = 64.0f;
+const float ENEMY_SIZE = 30.0f;
+const float SPAWN_SAFE_DISTANCE = 400.0f;
+const int ENEMY_CAPACITY = 256;     // Enemies reserved up front, spawning past this grows the arrays
+const int MAX_POWER_UPS = 32;
 
 float speedIncrement = 0.1f;
-bool gameOverSoundPlayed = false;
-int score = 0;
-
-Sound SFX6;
 
 enum EnemyType {
     GRUNT,
@@ -33,12 +54,10 @@ struct PowerUp {
     float slowFactor;
 };
 
-std::vector<PowerUp> powerUps;
-
-PowerUp createPowerUp(const int screenWidth, const int screenHeight) {
+PowerUp createPowerUp(const int screenWidth, const int screenHeight, RandomGenerator* rng) {
     PowerUp newPowerUp;
-    newPowerUp.type = static_cast<PowerUpType>(GetRandomValue(0, 3));
-    newPowerUp.position = {(float)GetRandomValue(30, screenWidth - 30), (float)GetRandomValue(30, screenHeight - 30)};
+    newPowerUp.type = static_cast<PowerUpType>(GetRandomValueFrom(rng, 0, 3));
+    newPowerUp.position = {(float)GetRandomValueFrom(rng, 30, screenWidth - 30), (float)GetRandomValueFrom(rng, 30, screenHeight - 30)};
     newPowerUp.duration = 5.0f; // Adjust duration as needed
 
     if (newPowerUp.type == SLOW) {
@@ -61,40 +80,138 @@ struct Player {
     float originalRadius;
     Vector2 velocity;
     Vector2 playerPos;
+    Vector2 previousPos;    // Position at the start of the last tick, for interpolated drawing
     Vector2 acceleration;
 };
 
-struct AnimationFrame {
-    Rectangle frameRec;
-    Vector2 position;
-    float updateTime;
-    float runningTime;
+const int MAX_CLIP_FRAMES = 4;
+
+enum AnimationClipId {
+    CLIP_GRUNT,
+    CLIP_SPRINTER,
+    CLIP_HEAVY,
+    CLIP_HEAVY_DAMAGED,
+    CLIP_COUNT,
 };
 
-struct Animation {
+// Frame data for one looping animation, shared (read only) by every enemy that plays it.
+// The playback state (current frame and time in it) is stored per enemy in Enemies
+struct AnimationClip {
     Texture2D spriteSheet;
-    AnimationFrame* frames;
+    Rectangle frames[MAX_CLIP_FRAMES];
     int frameCount;
-    int currentFrame;
+    float frameTime;
 };
 
-struct Enemy {
-    int enemyHealth;
-    EnemyType type;
-    Color color;
-    Vector2 target;
-    Rectangle rect;
-    float speed;
-    float hitCooldown;
-    Animation animation;
+// Enemies are stored as parallel arrays (structure of arrays): index i is the same enemy in
+// every array, so the movement update only streams positions and speeds through the cache
+struct Enemies {
+    std::vector<float> x;
+    std::vector<float> y;
+    std::vector<float> previousX;       // Position at the start of the last tick, for interpolated drawing
+    std::vector<float> previousY;
+    std::vector<float> speed;
+    std::vector<float> hitCooldown;
+    std::vector<int> health;
+    std::vector<EnemyType> type;
+    std::vector<unsigned char> frame;
+    std::vector<float> frameTime;
 };
 
-Enemy createEnemy (const int screenWidth, const int screenHeight, Vector2 target, Animation& gruntAnim, Animation& sprinterAnim, Animation& heavyAnim) {
+int enemyCount(const Enemies& enemies) {
+    return (int)enemies.x.size();
+}
+
+Rectangle enemyRect(const Enemies& enemies, int i) {
+    return (Rectangle){enemies.x[i], enemies.y[i], ENEMY_SIZE, ENEMY_SIZE};
+}
+
+void reserveEnemies(Enemies& enemies, int capacity) {
+    enemies.x.reserve(capacity);
+    enemies.y.reserve(capacity);
+    enemies.previousX.reserve(capacity);
+    enemies.previousY.reserve(capacity);
+    enemies.speed.reserve(capacity);
+    enemies.hitCooldown.reserve(capacity);
+    enemies.health.reserve(capacity);
+    enemies.type.reserve(capacity);
+    enemies.frame.reserve(capacity);
+    enemies.frameTime.reserve(capacity);
+}
+
+void resizeEnemies(Enemies& enemies, int count) {
+    enemies.x.resize(count);
+    enemies.y.resize(count);
+    enemies.previousX.resize(count);
+    enemies.previousY.resize(count);
+    enemies.speed.resize(count);
+    enemies.hitCooldown.resize(count);
+    enemies.health.resize(count);
+    enemies.type.resize(count);
+    enemies.frame.resize(count);
+    enemies.frameTime.resize(count);
+}
+
+// Spawn positions are the integer points of the field at least safeDistance away from target.
+// Instead of drawing field points until one is far enough (most are rejected with the 400 px
+// radius), the valid points are counted per column once, and a spawn draws a single index into
+// them: a binary search finds the column, the rest of the index picks y below or above the
+// excluded band. Same distribution as the rejection loop, constant cost per spawn
+struct SpawnSampler {
+    int minX, maxX;
+    int minY, maxY;
+    std::vector<int> columnStart;       // valid points in the columns before each column (+ total at the end)
+    std::vector<int> columnBelow;       // valid points above the excluded band (smaller y)
+    std::vector<int> columnResume;      // first valid y after the excluded band
+};
+
+void initSpawnSampler(SpawnSampler& sampler, int minX, int maxX, int minY, int maxY, Vector2 target, float safeDistance) {
+    const int columns = maxX - minX + 1;
+    sampler.minX = minX;
+    sampler.maxX = maxX;
+    sampler.minY = minY;
+    sampler.maxY = maxY;
+    sampler.columnStart.assign(columns + 1, 0);
+    sampler.columnBelow.assign(columns, 0);
+    sampler.columnResume.assign(columns, maxY + 1);
+
+    for (int c = 0; c < columns; c++) {
+        // The points of a column inside the circle are always one contiguous band
+        int bandStart = maxY + 1;
+        int bandEnd = maxY + 1;
+        for (int y = minY; y <= maxY; y++) {
+            bool tooClose = (Vector2Distance((Vector2){(float)(minX + c), (float)y}, target) < safeDistance);
+            if (tooClose && bandStart > maxY) bandStart = y;
+            if (!tooClose && bandStart <= maxY) { bandEnd = y; break; }
+        }
+
+        sampler.columnBelow[c] = bandStart - minY;
+        sampler.columnResume[c] = bandEnd;
+        sampler.columnStart[c + 1] = sampler.columnStart[c] + sampler.columnBelow[c] + (maxY + 1 - bandEnd);
+    }
+}
+
+Vector2 sampleSpawnPosition(const SpawnSampler& sampler, RandomGenerator* rng) {
+    const int total = sampler.columnStart.back();
+    if (total == 0) {
+        return (Vector2){(float)GetRandomValueFrom(rng, sampler.minX, sampler.maxX), (float)GetRandomValueFrom(rng, sampler.minY, sampler.maxY)};
+    }
+
+    int index = GetRandomValueFrom(rng, 0, total - 1);
+    int c = (int)(std::upper_bound(sampler.columnStart.begin(), sampler.columnStart.end(), index) - sampler.columnStart.begin()) - 1;
+    int offset = index - sampler.columnStart[c];
+
+    int y = (offset < sampler.columnBelow[c]) ? sampler.minY + offset : sampler.columnResume[c] + (offset - sampler.columnBelow[c]);
+    return (Vector2){(float)(sampler.minX + c), (float)y};
+}
+
+// Fills slot i with a new random enemy placed by spawnArea
+void createEnemy (Enemies& enemies, int i, const SpawnSampler& spawnArea, RandomGenerator* rng) {
     const int gruntSpawn = 60;
     const int sprinterSpawn = 30;
     const int heavySpawn = 10;
 
-    int randomValue = GetRandomValue(1, 100);
+    int randomValue = GetRandomValueFrom(rng, 1, 100);
 
     EnemyType type;
     if (randomValue <= gruntSpawn) {
@@ -106,134 +223,299 @@ Enemy createEnemy (const int screenWidth, const int screenHeight, Vector2 target
     else {
         type = HEAVY;
     }
-    
-    float safeDistance = 400.0f;
-    Vector2 spawnPos;
-
-    do {
-        spawnPos = (Vector2){(float)GetRandomValue(30, screenWidth - 30), (float)GetRandomValue(30, screenHeight - 30)};
-    } while (Vector2Distance(spawnPos, target) < safeDistance);
-
-    Enemy newEnemy;
-    newEnemy.rect = (Rectangle){spawnPos.x, spawnPos.y, 30, 30};
-    newEnemy.type = type;
-    newEnemy.enemyHealth = 1;
-    newEnemy.target = target;
-    newEnemy.hitCooldown = 0.0f;
+
+    Vector2 spawnPos = sampleSpawnPosition(spawnArea, rng);
+
+    enemies.x[i] = spawnPos.x;
+    enemies.y[i] = spawnPos.y;
+    enemies.previousX[i] = spawnPos.x;
+    enemies.previousY[i] = spawnPos.y;
+    enemies.type[i] = type;
+    enemies.health[i] = 1;
+    enemies.hitCooldown[i] = 0.0f;
+    enemies.frame[i] = 0;
+    enemies.frameTime[i] = 0.0f;
     switch (type) {
         case GRUNT:
-            newEnemy.animation = gruntAnim;
-            newEnemy.color = RED;
-            newEnemy.speed = 0.75f;
+            enemies.speed[i] = 0.75f;
             break;
         case SPRINTER:
-            newEnemy.animation = sprinterAnim;
-            newEnemy.color = YELLOW;
-            newEnemy.speed = 1.0f;
+            enemies.speed[i] = 1.0f;
             break;
         case HEAVY:
-            newEnemy.animation = heavyAnim;
-            newEnemy.color = GRAY;
-            newEnemy.enemyHealth = 2;
-            newEnemy.speed = 0.25f;
+            enemies.health[i] = 2;
+            enemies.speed[i] = 0.25f;
             break;
     }
-    return newEnemy;
 }
 
-void updateEnemy (Enemy &enemy, Vector2 target, float deltaTime) {
-    Vector2 direction = Vector2Normalize(Vector2Subtract(target, (Vector2){enemy.rect.x, enemy.rect.y}));
-    enemy.speed += speedIncrement * deltaTime;
-    enemy.rect.x += direction.x * enemy.speed;
-    enemy.rect.y += direction.y * enemy.speed;
+// Appends count new enemies
+void spawnEnemies (Enemies& enemies, int count, const SpawnSampler& spawnArea, RandomGenerator* rng) {
+    int first = enemyCount(enemies);
+    resizeEnemies(enemies, first + count);
+    for (int i = first; i < first + count; i++) {
+        createEnemy(enemies, i, spawnArea, rng);
+    }
 }
 
-void health (Enemy &enemy, const Player &player, Base &base, float deltaTime) {
-    Rectangle playerRect = {(player.playerPos.x - player.radius), (player.playerPos.y - player.radius), player.radius * 2, player.radius * 2};
+// Moves every enemy towards target by its speed (pixels per tick) and ramps the speed up: 8 enemies per iteration with AVX, 4 with SSE, scalar for the tail.
+// Uses the same math as Vector2Normalize (multiply by the reciprocal length) so every path agrees
+void updateEnemies (Enemies &enemies, Vector2 target, float deltaTime) {
+    PROFILE_SCOPE("updateEnemies");
+    float* x = enemies.x.data();
+    float* y = enemies.y.data();
+    float* speed = enemies.speed.data();
+    const int count = enemyCount(enemies);
+    const float speedStep = speedIncrement * deltaTime;
+    int i = 0;
+
+#if defined(__AVX__)
+    const __m256 targetX8 = _mm256_set1_ps(target.x);
+    const __m256 targetY8 = _mm256_set1_ps(target.y);
+    const __m256 speedStep8 = _mm256_set1_ps(speedStep);
+    const __m256 zero8 = _mm256_setzero_ps();
+    const __m256 one8 = _mm256_set1_ps(1.0f);
+
+    for (; i + 8 <= count; i += 8) {
+        __m256 posX = _mm256_loadu_ps(x + i);
+        __m256 posY = _mm256_loadu_ps(y + i);
+        __m256 dirX = _mm256_sub_ps(targetX8, posX);
+        __m256 dirY = _mm256_sub_ps(targetY8, posY);
+        __m256 length = _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(dirX, dirX), _mm256_mul_ps(dirY, dirY)));
+        __m256 ilength = _mm256_and_ps(_mm256_cmp_ps(length, zero8, _CMP_GT_OQ), _mm256_div_ps(one8, length));
+        __m256 newSpeed = _mm256_add_ps(_mm256_loadu_ps(speed + i), speedStep8);
+
+        _mm256_storeu_ps(speed + i, newSpeed);
+        _mm256_storeu_ps(x + i, _mm256_add_ps(posX, _mm256_mul_ps(_mm256_mul_ps(dirX, ilength), newSpeed)));
+        _mm256_storeu_ps(y + i, _mm256_add_ps(posY, _mm256_mul_ps(_mm256_mul_ps(dirY, ilength), newSpeed)));
+    }
+#endif
+
+#if defined(__SSE2__)
+    const __m128 targetX4 = _mm_set1_ps(target.x);
+    const __m128 targetY4 = _mm_set1_ps(target.y);
+    const __m128 speedStep4 = _mm_set1_ps(speedStep);
+    const __m128 zero4 = _mm_setzero_ps();
+    const __m128 one4 = _mm_set1_ps(1.0f);
+
+    for (; i + 4 <= count; i += 4) {
+        __m128 posX = _mm_loadu_ps(x + i);
+        __m128 posY = _mm_loadu_ps(y + i);
+        __m128 dirX = _mm_sub_ps(targetX4, posX);
+        __m128 dirY = _mm_sub_ps(targetY4, posY);
+        __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(dirX, dirX), _mm_mul_ps(dirY, dirY)));
+        __m128 ilength = _mm_and_ps(_mm_cmpgt_ps(length, zero4), _mm_div_ps(one4, length));
+        __m128 newSpeed = _mm_add_ps(_mm_loadu_ps(speed + i), speedStep4);
+
+        _mm_storeu_ps(speed + i, newSpeed);
+        _mm_storeu_ps(x + i, _mm_add_ps(posX, _mm_mul_ps(_mm_mul_ps(dirX, ilength), newSpeed)));
+        _mm_storeu_ps(y + i, _mm_add_ps(posY, _mm_mul_ps(_mm_mul_ps(dirY, ilength), newSpeed)));
+    }
+#endif
 
-    if (CheckCollisionCircleRec(base.basePos, base.radius, enemy.rect)) {
-        PlaySound(SFX6);
-        enemy.enemyHealth = 0;
-        base.health--;
-    } 
-    else if (enemy.hitCooldown <= 0.0f && CheckCollisionRecs(playerRect, enemy.rect)) {
-        enemy.enemyHealth--;
-        enemy.hitCooldown = 0.5f;
+    for (; i < count; i++) {
+        Vector2 direction = Vector2Normalize(Vector2Subtract(target, (Vector2){x[i], y[i]}));
+        speed[i] += speedStep;
+        x[i] += direction.x * speed[i];
+        y[i] += direction.y * speed[i];
     }
+}
+
+// Events raised by the simulation, the caller decides how to present them (sounds)
+enum SimEvent {
+    EVENT_SHOOT = 1 << 0,
+    EVENT_WALL_HIT = 1 << 1,
+    EVENT_POWERUP = 1 << 2,
+    EVENT_KILL = 1 << 3,
+    EVENT_BASE_HIT = 1 << 4,
+    EVENT_GAME_OVER = 1 << 5,
+};
 
-    if (enemy.hitCooldown > 0.0f) {
-        enemy.hitCooldown -= deltaTime;
+// Voice priorities for PlaySoundVoice(), a sound only steals voices playing the same or a lower priority
+enum SoundPriority {
+    PRIORITY_FEEDBACK,  // Shots and wall hits, frequent and short
+    PRIORITY_KILL,
+    PRIORITY_ALERT,     // Base hits, power-ups and game over must always be heard
+};
+
+// Input sampled once per rendered frame (or read back from a script when headless)
+struct SimInput {
+    Vector2 mousePosition;
+    bool mousePressed;
+    bool mouseReleased;
+};
+
+enum InputRecordFlags {
+    RECORD_PRESSED = 1 << 0,
+    RECORD_RELEASED = 1 << 1,
+};
+
+// One tick that had a click, ticks without clicks are not stored
+struct InputRecord {
+    unsigned int tick;
+    unsigned char flags;
+    Vector2 mousePosition;
+};
+
+// Everything needed to play a session again: the seed and the clicks, tick by tick.
+// The final scores are stored too so a replay can check it reproduced the session
+struct InputRecording {
+    unsigned int seed;
+    unsigned int ticks;
+    int finalScore;
+    int finalHighscore;
+    std::vector<InputRecord> records;
+};
+
+struct GameState {
+    Base base;
+    Player player;
+    Enemies enemies;
+    SpawnSampler spawnArea;
+    RandomGenerator rng;            // Simulation random stream, independent from GetRandomValue()
+    Pool<PowerUp> powerUps;
+    SpatialHash enemyGrid;
+    SpatialHash powerUpGrid;
+    std::vector<int> queryResults;
+    const AnimationClip* clips;
+    std::vector<SimInput> pendingClicks;    // Presses and releases no tick has handled yet, oldest first, each with its own position
+    Vector2 mousePosition;          // Latest mouse position, given to ticks without a click
+    Vector2 mouseDragStart;
+    Rectangle restartButton;
+    float accumulator;
+    float spawnTimer;
+    float gameOverDelay;
+    bool isGameOver;
+    bool gameOverSoundPlayed;
+    int score;
+    int highscore;
+    unsigned int events;
+    int kills;                      // Enemies killed since events were last cleared, one kill sound each
+    unsigned int tick;              // Ticks run since initGame()
+    InputRecording* recording;      // Clicks are appended here when not NULL
+};
+
+// Resolves enemy hits against the base and the player, only enemies sharing grid cells are tested
+void health (GameState &game) {
+    PROFILE_SCOPE("health");
+    Player &player = game.player;
+    Base &base = game.base;
+    Rectangle playerRect = {(player.playerPos.x - player.radius), (player.playerPos.y - player.radius), player.radius * 2, player.radius * 2};
+    Rectangle baseRect = {base.basePos.x - base.radius - 1, base.basePos.y - base.radius - 1, base.radius * 2 + 2, base.radius * 2 + 2};
+
+    QuerySpatialHash(game.enemyGrid, baseRect, game.queryResults);
+    for (int i : game.queryResults) {
+        if (CheckCollisionCircleRec(base.basePos, base.radius, enemyRect(game.enemies, i))) {
+            game.events |= EVENT_BASE_HIT;
+            game.enemies.health[i] = 0;
+            base.health--;
+        }
     }
 
+    QuerySpatialHash(game.enemyGrid, playerRect, game.queryResults);
+    for (int i : game.queryResults) {
+        if (game.enemies.health[i] > 0 && game.enemies.hitCooldown[i] <= 0.0f && CheckCollisionRecs(playerRect, enemyRect(game.enemies, i))) {
+            game.enemies.health[i]--;
+            game.enemies.hitCooldown[i] = 0.5f;
+        }
+    }
 }
 
-void applyPowerUp(Player& player, Base& base, std::vector<Enemy>& enemies, const PowerUp& powerUp) {
+void applyPowerUp(GameState& game, const PowerUp& powerUp) {
     switch (powerUp.type) {
         case HEAL_BASE:
-            base.health = 3;
+            game.base.health = 3;
             break;
         case UP_PLAYER_SIZE:
-            player.radius *= 1.1f;
+            game.player.radius *= 1.1f;
             break;
         case INCREASE_SCORE1:
-            score += 100;
+            game.score += 100;
             break;
         case SLOW:
-            for (Enemy& enemy : enemies) {
-                enemy.speed *= powerUp.slowFactor;
+            for (float& speed : game.enemies.speed) {
+                speed *= powerUp.slowFactor;
             }
             break;
     }
 }
 
-void InitAnimation(Animation* anim, Texture2D spriteSheet, int frameCount, int frameWidth, int frameHeight) {
-    anim->spriteSheet = spriteSheet;
-    anim->frames = (AnimationFrame*)malloc(frameCount * sizeof(AnimationFrame));
-    anim->frameCount = frameCount;
-    anim->currentFrame = 0;
+void InitAnimationClip(AnimationClip* clip, Texture2D spriteSheet, int firstFrame, int frameCount, int frameWidth, int frameHeight) {
+    clip->spriteSheet = spriteSheet;
+    clip->frameCount = frameCount;
+    clip->frameTime = 1.0f / 12.0f; // Example frame rate
 
     for (int i = 0; i < frameCount; ++i) {
-        anim->frames[i].frameRec = (Rectangle){static_cast<float>(frameWidth * i), 0.0f, static_cast<float>(frameWidth), static_cast<float>(frameHeight)};
-        anim->frames[i].updateTime = 1.0f / 12.0f; // Example frame rate
-        anim->frames[i].runningTime = 0.0f;
+        clip->frames[i] = (Rectangle){static_cast<float>(frameWidth * (firstFrame + i)), 0.0f, static_cast<float>(frameWidth), static_cast<float>(frameHeight)};
     }
 }
 
-void UpdateAnimation(Animation* anim, Enemy& enemy, float deltaTime) {
-    anim->frames[anim->currentFrame].runningTime += deltaTime;
+void InitEnemyClips(AnimationClip clips[CLIP_COUNT], Texture2D gruntSprite, Texture2D sprinterSprite, Texture2D heavySprite) {
+    InitAnimationClip(&clips[CLIP_GRUNT], gruntSprite, 0, 2, 16, 17);
+    InitAnimationClip(&clips[CLIP_SPRINTER], sprinterSprite, 0, 3, 16, 18);
+    InitAnimationClip(&clips[CLIP_HEAVY], heavySprite, 0, 2, 16, 17);           // Full health: first two frames
+    InitAnimationClip(&clips[CLIP_HEAVY_DAMAGED], heavySprite, 2, 2, 16, 17);   // One hit left: frames 3 and 4
+}
 
-    if (anim->frames[anim->currentFrame].runningTime >= anim->frames[anim->currentFrame].updateTime) {
-        anim->frames[anim->currentFrame].runningTime = 0.0f;
+// Packs the three enemy sheets into one atlas texture and points the clips at it, so enemies of
+// every type share a texture and DrawSprites() draws them all in one call. The sheets are
+// decoded by the asset loader, only the packing and upload happen here
+TextureAtlas LoadEnemyAtlas(AnimationClip clips[CLIP_COUNT], AssetLoader& loader, const AssetJob sheetJobs[3]) {
+    TextureAtlas atlas = {0};
+    int sheets[3];
+
+    for (int i = 0; i < 3; i++) {
+        Image image = WaitImage(loader, sheetJobs[i]);
+        sheets[i] = AddTextureAtlasImage(&atlas, image);
+        UnloadImage(image);
+    }
+    BuildTextureAtlas(&atlas, 1);
 
-        if (enemy.type == HEAVY) {
-            if (enemy.enemyHealth == 2) {
-                // Limit to the first two frames
-                anim->currentFrame = (anim->currentFrame + 1) % 2;
-            } else if (enemy.enemyHealth == 1) {
-                
-                // Use frames 3 and 4 (index 2 and 3)
-                anim->currentFrame = 2 + ((anim->currentFrame - 2 + 1) % 2);
-            }
-        } else {
-            anim->currentFrame = (anim->currentFrame + 1) % anim->frameCount;
+    InitEnemyClips(clips, atlas.texture, atlas.texture, atlas.texture);
+
+    const int clipSheets[CLIP_COUNT] = {sheets[0], sheets[1], sheets[2], sheets[2]};
+    for (int c = 0; c < CLIP_COUNT; c++) {
+        for (int f = 0; f < clips[c].frameCount; f++) {
+            clips[c].frames[f] = GetTextureAtlasRec(atlas, clipSheets[c], clips[c].frames[f]);
+        }
+    }
+
+    return atlas;
+}
+
+AnimationClipId enemyClip(EnemyType type, int enemyHealth) {
+    switch (type) {
+        case GRUNT: return CLIP_GRUNT;
+        case SPRINTER: return CLIP_SPRINTER;
+        default: return (enemyHealth >= 2) ? CLIP_HEAVY : CLIP_HEAVY_DAMAGED;
+    }
+}
+
+// Advances the playback state of every enemy in one pass over the frame/time arrays
+void updateAnimations(Enemies& enemies, const AnimationClip clips[CLIP_COUNT], float deltaTime) {
+    PROFILE_SCOPE("updateAnimations");
+    const int count = enemyCount(enemies);
+
+    for (int i = 0; i < count; i++) {
+        const AnimationClip& clip = clips[enemyClip(enemies.type[i], enemies.health[i])];
+
+        enemies.frameTime[i] += deltaTime;
+        if (enemies.frameTime[i] >= clip.frameTime) {
+            enemies.frameTime[i] = 0.0f;
+            enemies.frame[i] = (unsigned char)((enemies.frame[i] + 1) % clip.frameCount);
         }
     }
 }
 
 
-void drawEnemy(const Enemy &enemy) {
-    AnimationFrame frame = enemy.animation.frames[enemy.animation.currentFrame];
+// Sprite for one enemy at its interpolated position, drawn later together with the others by DrawSprites()
+SpriteInstance enemySprite(const Enemies &enemies, int i, const AnimationClip clips[CLIP_COUNT], float alpha) {
+    const AnimationClip &clip = clips[enemyClip(enemies.type[i], enemies.health[i])];
+    Rectangle frameRec = clip.frames[enemies.frame[i] % clip.frameCount];
     
-    Rectangle destRec = {enemy.rect.x, enemy.rect.y, enemy.rect.width, enemy.rect.height};
+    Rectangle destRec = {Lerp(enemies.previousX[i], enemies.x[i], alpha), Lerp(enemies.previousY[i], enemies.y[i], alpha), ENEMY_SIZE, ENEMY_SIZE};
 
-    DrawTexturePro(
-        enemy.animation.spriteSheet, 
-        frame.frameRec, 
-        destRec, 
-        Vector2{0, 0},
-        0.0f,
-        WHITE
-    );
+    return SpriteInstance{clip.spriteSheet, frameRec, destRec, Vector2{0, 0}, 0.0f, WHITE};
 }
 // Computes for impulse given the following parameters :
 // elasticity, relative velocity, collision normal, and the inverse masses of the two objects
@@ -261,10 +543,11 @@ void drawEnemy(const Enemy &enemy) {
 //     }
 // };
 
-void DrawHealthBar(int x, int y, int width, int height, int currentHealth, int maxHealth, Color barColor, Color borderColor) {
-    // Draw the border
+void DrawHealthBarBorder(int x, int y, int width, int height, Color borderColor) {
     DrawRectangle(x - 2, y - 2, width + 4, height + 4, borderColor);
+}
 
+void DrawHealthBarFill(int x, int y, int width, int height, int currentHealth, int maxHealth, Color barColor) {
     // Calculate the percentage of health remaining
     float healthPercentage = (float)currentHealth / maxHealth;
 
@@ -275,271 +558,1154 @@ void DrawHealthBar(int x, int y, int width, int height, int currentHealth, int m
     DrawRectangle(x, y, barWidth, height, barColor);
 }
 
-int main() {
-    InitAudioDevice();
+void DrawHealthBar(int x, int y, int width, int height, int currentHealth, int maxHealth, Color barColor, Color borderColor) {
+    DrawHealthBarBorder(x, y, width, height, borderColor);
+    DrawHealthBarFill(x, y, width, height, currentHealth, maxHealth, barColor);
+}
 
-    Sound BGM = LoadSound("BGM.ogg");
-    Sound SFX1 = LoadSound("ShootSFX.ogg");
-    Sound SFX2 = LoadSound("DieSFX.ogg");
-    Sound SFX3 = LoadSound("PowerupSFX.ogg");
-    Sound SFX4 = LoadSound("WallHitSFX.ogg");
-    Sound SFX5 = LoadSound("KillSFX.ogg");
-    SFX6 = LoadSound("HeavyDMGSFX.ogg");
+void resetGame(GameState& game) {
+    game.score = 0;
+    game.base.health = 3;
+    game.base.radius = 50.0f;
+    game.base.basePos = {SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2};
+    game.player.playerPos = {SCREEN_WIDTH / 2.0f, SCREEN_HEIGHT / 2.0f};
+    game.player.previousPos = game.player.playerPos;
+    game.player.velocity = {0, 0};
+    game.player.acceleration = {0, 0};
+    game.player.radius = 20.0f;
+    game.isGameOver = false;
+    game.gameOverDelay = 1.0f;
+    game.gameOverSoundPlayed = false;
+    game.spawnTimer = 0.0f;
+    resizeEnemies(game.enemies, 0);
+    spawnEnemies(game.enemies, 3, game.spawnArea, &game.rng);
+}
 
-    SetSoundVolume(BGM, 0.7f);
-    SetSoundVolume(SFX3, 0.5f);
+// Same seed, same inputs: same game
+void initGame(GameState& game, const AnimationClip clips[CLIP_COUNT], unsigned int seed) {
+    SetRandomGeneratorSeed(&game.rng, seed);
+    game.clips = clips;
+    InitPool(game.powerUps, MAX_POWER_UPS);
+    reserveEnemies(game.enemies, ENEMY_CAPACITY);
+    initSpawnSampler(game.spawnArea, 30, SCREEN_WIDTH - 30, 30, SCREEN_HEIGHT - 30, {SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2}, SPAWN_SAFE_DISTANCE);
+    game.player.isDragging = false;
+    game.player.originalRadius = 20.0f;
+    game.mouseDragStart = Vector2Zero();
+    game.restartButton = {SCREEN_WIDTH / 2 - 50, SCREEN_HEIGHT / 2 + 60, 100, 30};
+    InitSpatialHash(game.enemyGrid, {0, 0, SCREEN_WIDTH, SCREEN_HEIGHT}, GRID_CELL_SIZE);
+    InitSpatialHash(game.powerUpGrid, {0, 0, SCREEN_WIDTH, SCREEN_HEIGHT}, GRID_CELL_SIZE);
+    game.accumulator = 0.0f;
+    game.pendingClicks.clear();
+    game.mousePosition = Vector2Zero();
+    game.highscore = 0;
+    game.events = 0;
+    game.kills = 0;
+    game.tick = 0;
+    game.recording = NULL;
+    resetGame(game);
+}
 
-    Base playerBase;
-    Player player1;
-    Animation sprinterAnim, gruntAnim, heavyAnim;
+// Advances every gameplay system by exactly one TIMESTEP
+void tickGame(GameState& game, const SimInput& input) {
+    PROFILE_SCOPE("tickGame");
+    const float spawnInterval = 10.0f;
+    const float deltaTime = TIMESTEP;
+    Player& player1 = game.player;
+    Base& playerBase = game.base;
 
-    int highscore = 0;
-    float accumulator = 0;
-    float gameOverDelay = 1.0f;
-    bool isGameOver = false;
-    const float maxAccumulator = 0.1f;
-    const int screenWidth = 800;
-    const int screenHeight = 600;
+    if (game.recording != NULL && (input.mousePressed || input.mouseReleased)) {
+        unsigned char flags = (input.mousePressed ? RECORD_PRESSED : 0) | (input.mouseReleased ? RECORD_RELEASED : 0);
+        game.recording->records.push_back((InputRecord){game.tick, flags, input.mousePosition});
+    }
+    game.tick++;
 
+    player1.previousPos = player1.playerPos;
+    game.enemies.previousX = game.enemies.x;
+    game.enemies.previousY = game.enemies.y;
 
-    InitWindow(screenWidth, screenHeight, "SQUARE OFF");
-    SetTargetFPS(60); // Set the target frame rate
+    game.spawnTimer += deltaTime;
 
-    Texture2D sprinterSprite = LoadTexture("SPRINTER.png");
-    Texture2D gruntSprite = LoadTexture("GRUNT.png");
-    Texture2D heavySprite = LoadTexture("HEAVY.png");
+    if (playerBase.health <= 0) {
+        game.isGameOver = true;
+        if (!game.gameOverSoundPlayed) {
+            game.events |= EVENT_GAME_OVER;
+            game.gameOverSoundPlayed = true;
+        }
+        game.gameOverDelay -= deltaTime;
+    }
 
+    if (!game.isGameOver) {
+        if (player1.playerPos.x - player1.radius < 0 || player1.playerPos.x + player1.radius > SCREEN_WIDTH) {
+            game.events |= EVENT_WALL_HIT;
+            player1.velocity.x *= -1;
+            player1.playerPos.x = Clamp(player1.playerPos.x, player1.radius, SCREEN_WIDTH - player1.radius);
+        }
 
-    InitAnimation(&sprinterAnim, sprinterSprite, 3, 16, 18);
-    InitAnimation(&gruntAnim, gruntSprite, 2, 16, 17);
-    InitAnimation(&heavyAnim, heavySprite, 4, 16, 17); 
+        if (player1.playerPos.y - player1.radius < 0 || player1.playerPos.y + player1.radius > SCREEN_HEIGHT) {
+            game.events |= EVENT_WALL_HIT;
+            player1.velocity.y *= -1;
+            player1.playerPos.y = Clamp(player1.playerPos.y, player1.radius, SCREEN_HEIGHT - player1.radius);
+        }
 
-    playerBase.health = 3;
-    playerBase.radius = 50.0f;
-    player1.radius = 20.0f;
-    player1.isDragging = false;
-    player1.playerPos = {screenWidth / 2.0f, screenHeight / 2.0f};;
-    player1.acceleration = {0,0};
+        if (player1.playerPos.x - player1.radius < 0 || player1.playerPos.x + player1.radius > SCREEN_WIDTH ||
+            player1.playerPos.y - player1.radius < 0 || player1.playerPos.y + player1.radius > SCREEN_HEIGHT) {
 
-    Rectangle restartButton = {screenWidth / 2 - 50, screenHeight / 2 + 60, 100, 30};
+            player1.playerPos = {400,300};
+        }
 
-    playerBase.basePos = {screenWidth / 2, screenHeight / 2};
-    player1.velocity = {0, 0};
+        // Press first, so a tick given both (older recordings) still starts and ends the drag
+        if (input.mousePressed) {
+            if (!player1.isDragging) {
+                game.mouseDragStart = input.mousePosition;
+                player1.isDragging = true;
+            }
+        }
 
-    Vector2 mouse_drag_start = Vector2Zero();
-    
+        if (input.mouseReleased && player1.isDragging) {
+            player1.velocity = Vector2Subtract(game.mouseDragStart, input.mousePosition);
+            player1.isDragging = false;
+            game.events |= EVENT_SHOOT;
+        }
 
-    std::vector<Enemy> enemies;
-    for (int i = 0; i < 3; ++i) {
-        enemies.push_back(createEnemy(screenWidth, screenHeight, playerBase.basePos, gruntAnim, sprinterAnim, heavyAnim));
-    }
+        player1.velocity = Vector2Add(player1.velocity, Vector2Scale(player1.acceleration, TIMESTEP));
+        player1.playerPos = Vector2Add(player1.playerPos, Vector2Scale(player1.velocity, TIMESTEP));
 
-    float spawnTimer = 0.0f;
-    const float spawnInterval = 10.0f;
+        player1.velocity = Vector2Add(player1.velocity, Vector2Scale(player1.acceleration, TIMESTEP));
+        player1.velocity = Vector2Scale(player1.velocity, FRICTION);
 
-    while (!WindowShouldClose()) {
-        float delta_time = GetFrameTime();
-        spawnTimer += delta_time;
+        if (game.spawnTimer >= spawnInterval) {
+            game.spawnTimer = 0.0f;
+            spawnEnemies(game.enemies, 1, game.spawnArea, &game.rng);
+        }
 
-        if(!IsSoundPlaying(BGM)){
-            PlaySound(BGM);
+        Enemies &enemies = game.enemies;
+        const int count = enemyCount(enemies);
+
+        updateAnimations(enemies, game.clips, deltaTime);
+        updateEnemies(enemies, playerBase.basePos, deltaTime);
+
+        {
+            PROFILE_SCOPE("enemyGrid");
+            BuildSpatialHash(game.enemyGrid, count, [&](int i) { return enemyRect(enemies, i); });
         }
-        
-        if (playerBase.health <= 0) {
-            isGameOver = true;
-            if(!gameOverSoundPlayed){
-                PlaySound(SFX2);
-                gameOverSoundPlayed = true;
+        health(game);
+
+        {
+            PROFILE_SCOPE("enemyLifecycle");
+            for (int i = 0; i < count; i++) {
+                if (enemies.hitCooldown[i] > 0.0f) {
+                    enemies.hitCooldown[i] -= deltaTime;
+                }
+
+                if (enemies.health[i] <= 0) {
+                    game.events |= EVENT_KILL;
+                    game.kills++;
+                    createEnemy(enemies, i, game.spawnArea, &game.rng);
+                    game.score += 10;
+                }
             }
-            gameOverDelay -= delta_time;
         }
 
-        if (!isGameOver) {
-            Vector2 mouse_position = GetMousePosition();
-            Vector2 cue_stick_force = Vector2Zero();
+        if (game.score > game.highscore) {
+            game.highscore = game.score;
+        }
 
-            if (player1.playerPos.x - player1.radius < 0 || player1.playerPos.x + player1.radius > screenWidth) {
-                PlaySound(SFX4);
-                player1.velocity.x *= -1;
-                player1.playerPos.x = Clamp(player1.playerPos.x, player1.radius, screenWidth - player1.radius);
+        {
+            PROFILE_SCOPE("powerUps");
+            if (GetRandomValueFrom(&game.rng, 0, 1000) < 5) { // Adjust the probability as needed
+                AddPoolItem(game.powerUps, createPowerUp(SCREEN_WIDTH, SCREEN_HEIGHT, &game.rng)); // Dropped if the pool is full
             }
 
-            if (player1.playerPos.y - player1.radius < 0 || player1.playerPos.y + player1.radius > screenHeight) {
-                PlaySound(SFX4);
-                player1.velocity.y *= -1;
-                player1.playerPos.y = Clamp(player1.playerPos.y, player1.radius, screenHeight - player1.radius);
-            }
+            // Pickup and expiry in one pass, backwards so swap-removal only moves already visited power-ups
+            Rectangle playerRect = {player1.playerPos.x - player1.radius - 1, player1.playerPos.y - player1.radius - 1, player1.radius * 2 + 2, player1.radius * 2 + 2};
+            BuildSpatialHash(game.powerUpGrid, game.powerUps.count, [&](int i) { return (Rectangle){game.powerUps.items[i].position.x, game.powerUps.items[i].position.y, 10, 10}; });
+            QuerySpatialHash(game.powerUpGrid, playerRect, game.queryResults);
 
-            if (player1.playerPos.x - player1.radius < 0 || player1.playerPos.x + player1.radius > screenWidth ||
-                player1.playerPos.y - player1.radius < 0 || player1.playerPos.y + player1.radius > screenHeight) {
+            for (int i = game.powerUps.count - 1; i >= 0; i--) {
+                PowerUp &powerUp = game.powerUps.items[i];
+                bool pickedUp = InLastSpatialHashQuery(game.powerUpGrid, i) &&
+                                CheckCollisionCircleRec(player1.playerPos, player1.radius, {powerUp.position.x, powerUp.position.y, 10, 10});
 
-                player1.playerPos = {400,300};
-            }
+                if (pickedUp) {
+                    game.events |= EVENT_POWERUP;
+                    applyPowerUp(game, powerUp);
+                }
 
-            if(IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
-                Vector2 mousePosition = GetMousePosition();
-                if (!player1.isDragging) {
-                    mouse_drag_start = mousePosition;
-                    player1.isDragging = true;
+                powerUp.duration -= deltaTime;
+                if (pickedUp || powerUp.duration <= 0.0f) {
+                    RemovePoolItemAt(game.powerUps, i);
                 }
             }
+        }
+    }
+    else if (game.gameOverDelay <= 0 && input.mousePressed && CheckCollisionPointRec(input.mousePosition, game.restartButton)) {
+        resetGame(game);
+    }
+}
 
-            else if (IsMouseButtonReleased(MOUSE_LEFT_BUTTON) && player1.isDragging) {
-                Vector2 mouse_drag_end = GetMousePosition();
-                player1.velocity = Vector2Subtract(mouse_drag_start, mouse_drag_end);
-                player1.isDragging = false;
-                PlaySound(SFX1);
-            }
+// Runs as many ticks as the elapsed time covers, the remainder stays in the accumulator and
+// is used to interpolate drawing between the last two ticks. Presses and releases are queued with
+// the position they happened at and handed to ticks one at a time, so a click pressed and released
+// between two ticks is still seen as a press on one tick and a release on the next
+void stepGame(GameState& game, const SimInput& input, float deltaTime) {
+    PROFILE_SCOPE("stepGame");
+    game.events = 0;
+    game.kills = 0;
+    game.mousePosition = input.mousePosition;
+    if (input.mousePressed) game.pendingClicks.push_back({input.mousePosition, true, false});
+    if (input.mouseReleased) game.pendingClicks.push_back({input.mousePosition, false, true});
+
+    game.accumulator = fminf(game.accumulator + deltaTime, MAX_ACCUMULATOR);
+
+    while (game.accumulator >= TIMESTEP) {
+        SimInput tickInput = {game.mousePosition, false, false};
+        if (!game.pendingClicks.empty()) {
+            tickInput = game.pendingClicks.front();
+            game.pendingClicks.erase(game.pendingClicks.begin());
+        }
 
-            // Vector2 shot_dir = Vector2Subtract(mouse_position, mouse_drag_start);
-            // float shot_vector_distance = Vector2Length(shot_dir);
-            // if (shot_vector_distance > 150.0f) {
-            //     shot_vector_distance = 150.0f;
-            // }
-            // shot_dir = Vector2Normalize(shot_dir);
-            accumulator += delta_time;
-
-            while (accumulator >= TIMESTEP) {
-                player1.velocity = Vector2Add(player1.velocity, Vector2Scale(player1.acceleration, TIMESTEP));
-                player1.playerPos = Vector2Add(player1.playerPos, Vector2Scale(player1.velocity, TIMESTEP));
-
-                player1.velocity = Vector2Add(player1.velocity, Vector2Scale(player1.acceleration, TIMESTEP));
-                player1.velocity = Vector2Scale(player1.velocity, FRICTION);
-                accumulator -= TIMESTEP;
+        tickGame(game, tickInput);
+        game.accumulator -= TIMESTEP;
+    }
+}
+
+// Recording file layout, little endian: "SQRC", version, seed, ticks, final score, final highscore,
+// record count, then per record: tick (4 bytes), flags (1 byte), mouse x and y (4 bytes floats each)
+const unsigned int RECORDING_VERSION = 1;
+const int RECORD_SIZE = 13;
+const int RECORDING_HEADER_SIZE = 28;
+
+bool saveRecording(const char* fileName, const InputRecording& recording) {
+    std::vector<unsigned char> data(RECORDING_HEADER_SIZE + recording.records.size() * RECORD_SIZE);
+    unsigned char* out = data.data();
+    unsigned int header[6] = {RECORDING_VERSION, recording.seed, recording.ticks, (unsigned int)recording.finalScore,
+                              (unsigned int)recording.finalHighscore, (unsigned int)recording.records.size()};
+
+    memcpy(out, "SQRC", 4);
+    memcpy(out + 4, header, sizeof(header));
+    out += RECORDING_HEADER_SIZE;
+
+    for (const InputRecord& record : recording.records) {
+        memcpy(out, &record.tick, 4);
+        out[4] = record.flags;
+        memcpy(out + 5, &record.mousePosition.x, 4);
+        memcpy(out + 9, &record.mousePosition.y, 4);
+        out += RECORD_SIZE;
+    }
+
+    return SaveFileData(fileName, data.data(), (unsigned int)data.size());
+}
+
+bool loadRecording(const char* fileName, InputRecording& recording) {
+    unsigned int size = 0;
+    unsigned char* data = LoadFileData(fileName, &size);
+    if (data == NULL) return false;
+
+    unsigned int header[6] = {0};
+    bool valid = (size >= (unsigned int)RECORDING_HEADER_SIZE) && (memcmp(data, "SQRC", 4) == 0);
+    if (valid) {
+        memcpy(header, data + 4, sizeof(header));
+        valid = (header[0] == RECORDING_VERSION) && (size == RECORDING_HEADER_SIZE + header[5] * RECORD_SIZE);
+    }
+
+    if (valid) {
+        recording.seed = header[1];
+        recording.ticks = header[2];
+        recording.finalScore = (int)header[3];
+        recording.finalHighscore = (int)header[4];
+        recording.records.resize(header[5]);
+
+        const unsigned char* in = data + RECORDING_HEADER_SIZE;
+        for (InputRecord& record : recording.records) {
+            memcpy(&record.tick, in, 4);
+            record.flags = in[4];
+            memcpy(&record.mousePosition.x, in + 5, 4);
+            memcpy(&record.mousePosition.y, in + 9, 4);
+            in += RECORD_SIZE;
+        }
+    }
+
+    UnloadFileData(data);
+    return valid;
+}
+
+// Draw queue layers, drawn bottom to top at every batch flush; inside a layer draws are
+// regrouped by texture and primitive mode, so only things that never overlap share one
+enum DrawLayer {
+    LAYER_POWER_UPS,
+    LAYER_PLAYER,
+    LAYER_BASE,
+    LAYER_ENEMIES,
+    LAYER_HUD,
+};
+
+// HUD parts that never change, or only with the base position and size, kept in GPU memory
+// so they are not tessellated and uploaded again every frame
+struct StaticLayers {
+    rlCommandBuffer commands;       // Scratch buffer the layers are recorded into
+    rlStaticLayer base;             // Base outline and health bar border
+    rlStaticLayer score;            // Score label
+    rlStaticLayer gameOver;         // Game over title and restart button
+    Vector2 basePos;                // Base the base layer was recorded for
+    float baseRadius;
+    bool loaded = false;
+    bool enabled = true;            // Draw everything immediately when disabled
+};
+
+void drawBaseFrame(const Base& base) {
+    DrawCircleLines(base.basePos.x, base.basePos.y, base.radius, RED);
+    DrawHealthBarBorder(base.basePos.x - base.radius, base.basePos.y + base.radius + 10, base.radius * 2, 10, BLACK);
+}
+
+void drawScoreLabel() {
+    DrawText("Score: ", 30, 30, 20, WHITE);
+}
+
+void drawScoreValue(int score) {
+    // DrawText() spaces characters by fontSize/10 pixels, the value continues right after the label
+    DrawText(TextFormat("%d", score), 30 + MeasureText("Score: ", 20) + 20 / 10, 30, 20, WHITE);
+}
+
+void drawGameOverFrame(const GameState& game) {
+    DrawText("Game Over", SCREEN_WIDTH / 2 - MeasureText("Game Over", 20) / 2, SCREEN_HEIGHT / 2, 20, WHITE);
+    DrawRectangleRec(game.restartButton, GRAY);
+    DrawText("Restart", game.restartButton.x + 10, game.restartButton.y + 5, 20, BLACK);
+}
+
+template <typename DrawFunc>
+rlStaticLayer recordStaticLayer(rlCommandBuffer& commands, DrawFunc draw) {
+    rlBeginCommandBuffer(&commands);
+    draw();
+    rlEndCommandBuffer();
+    return rlLoadStaticLayer(&commands);
+}
+
+// Records the layers on first use and the base layer again whenever the base moves or resizes
+void updateStaticLayers(StaticLayers& layers, const GameState& game) {
+    if (!layers.loaded) {
+        layers.commands = rlLoadCommandBuffer(1024);
+        layers.score = recordStaticLayer(layers.commands, [&]() { drawScoreLabel(); });
+        layers.gameOver = recordStaticLayer(layers.commands, [&]() { drawGameOverFrame(game); });
+        layers.base = recordStaticLayer(layers.commands, [&]() { drawBaseFrame(game.base); });
+        layers.basePos = game.base.basePos;
+        layers.baseRadius = game.base.radius;
+        layers.loaded = true;
+    }
+    else if (!Vector2Equals(layers.basePos, game.base.basePos) || layers.baseRadius != game.base.radius) {
+        rlUnloadStaticLayer(layers.base);
+        layers.base = recordStaticLayer(layers.commands, [&]() { drawBaseFrame(game.base); });
+        layers.basePos = game.base.basePos;
+        layers.baseRadius = game.base.radius;
+    }
+}
+
+void unloadStaticLayers(StaticLayers& layers) {
+    if (!layers.loaded) return;
+    rlUnloadStaticLayer(layers.base);
+    rlUnloadStaticLayer(layers.score);
+    rlUnloadStaticLayer(layers.gameOver);
+    rlUnloadCommandBuffer(layers.commands);
+    layers.loaded = false;
+}
+
+// sprites is scratch space reused across frames for the enemy sprite batch
+void drawGame(const GameState& game, std::vector<SpriteInstance>& sprites, StaticLayers& layers) {
+    PROFILE_SCOPE("drawGame");
+    const Player& player1 = game.player;
+    const Base& playerBase = game.base;
+    const float alpha = game.accumulator / TIMESTEP;     // How far drawing is between the last two ticks
+
+    ClearBackground(BLACK);
+    if (layers.enabled) updateStaticLayers(layers, game);
+
+    rlSetDrawLayer(LAYER_POWER_UPS);
+    if (!game.isGameOver) {
+        for (int i = 0; i < game.powerUps.count; i++) {
+            const PowerUp &powerUp = game.powerUps.items[i];
+            // Draw different shapes or symbols based on the power-up type
+            switch (powerUp.type) {
+                case HEAL_BASE:
+                    DrawCircleV(powerUp.position, 10, GREEN); // Green circle for heal
+                    break;
+                case UP_PLAYER_SIZE:
+                    if (player1.radius <= 40.0f){
+                        DrawRectangleV(Vector2{ powerUp.position.x - 5, powerUp.position.y - 5 }, Vector2{ 20, 20 }, BLUE);
+                    }
+                    break;
+                case INCREASE_SCORE1:
+                    DrawTriangle({ powerUp.position.x - 5, powerUp.position.y + 5 }, { powerUp.position.x + 5, powerUp.position.y + 5 }, { powerUp.position.x, powerUp.position.y - 5 }, PURPLE); // Purple triangle for immunity
+                    break;
+                case SLOW:
+                    DrawLineV({ powerUp.position.x - 5, powerUp.position.y - 5 }, { powerUp.position.x + 5, powerUp.position.y + 5 }, ORANGE);
+                    DrawLineV({ powerUp.position.x - 5, powerUp.position.y + 5 }, { powerUp.position.x + 5, powerUp.position.y - 5 }, ORANGE);
+                    break;
             }
+        }
+    }
 
-            if (spawnTimer >= spawnInterval) {
-                spawnTimer = 0.0f;
-                for (int i = 0; i < 1; i++) {
-                    enemies.push_back(createEnemy(screenWidth, screenHeight, playerBase.basePos, gruntAnim, sprinterAnim, heavyAnim));
-                }
+    // DrawCircle(screenWidth / 2, screenHeight / 2, 75.0f, YELLOW); // Base
+    rlSetDrawLayer(LAYER_PLAYER);
+    DrawCircleV(Vector2Lerp(player1.previousPos, player1.playerPos, alpha), player1.radius, RED);
+
+    rlSetDrawLayer(LAYER_BASE);
+    if (playerBase.health > 0) {
+        if (layers.enabled) rlDrawStaticLayer(&layers.base, MatrixIdentity());
+        else drawBaseFrame(playerBase);
+
+        DrawHealthBarFill(playerBase.basePos.x - playerBase.radius, playerBase.basePos.y + playerBase.radius + 10, playerBase.radius * 2, 10, playerBase.health, 3, RED);
+    }
+
+    rlSetDrawLayer(LAYER_ENEMIES);
+    sprites.clear();
+    for (int i = 0; i < enemyCount(game.enemies); i++) {
+        if (game.enemies.health[i] > 0) {
+            sprites.push_back(enemySprite(game.enemies, i, game.clips, alpha));
+        }
+    }
+    DrawSprites(sprites.data(), (int)sprites.size());
+
+    // Overlays drawn after drawGame() stay in this layer too
+    rlSetDrawLayer(LAYER_HUD);
+    if (layers.enabled) rlDrawStaticLayer(&layers.score, MatrixIdentity());
+    else drawScoreLabel();
+    drawScoreValue(game.score);
+
+    if (game.isGameOver && game.gameOverDelay <= 0) {
+        // Draw game over message
+        if (layers.enabled) rlDrawStaticLayer(&layers.gameOver, MatrixIdentity());
+        else drawGameOverFrame(game);
+        DrawText(TextFormat("High Score: %d", game.highscore), SCREEN_WIDTH / 2 - MeasureText("High Score: ", 20) / 2, SCREEN_HEIGHT / 2 + 20, 20, WHITE);
+    }
+}
+
+// Render counters for the F3 overlay: batch is the whole last frame, cull is this frame so far
+void drawRenderStats(const rlBatchStats& batch, const DrawCullStats& cull, int x, int y) {
+    const int fontSize = 10;
+    const int lineHeight = 12;
+
+    DrawRectangle(x, y, 300, 4 * lineHeight + 8, Fade(BLACK, 0.75f));
+    DrawText(TextFormat("draw calls %d  vertices %d  uploaded %.1f KB", batch.drawCalls, batch.vertices, batch.bytesUploaded / 1024.0f), x + 4, y + 4, fontSize, YELLOW);
+    DrawText(TextFormat("flushes %d: state %d  vertex full %d  draws full %d", batch.flushes, batch.stateFlushes, batch.vertexOverflows, batch.drawCallOverflows), x + 4, y + 4 + lineHeight, fontSize, WHITE);
+    DrawText(TextFormat("new draw call on texture change %d  mode change %d", batch.textureChanges, batch.modeChanges), x + 4, y + 4 + 2 * lineHeight, fontSize, WHITE);
+    DrawText(TextFormat("culled %u  emitted %u", cull.culled, cull.emitted), x + 4, y + 4 + 3 * lineHeight, fontSize, LIGHTGRAY);
+}
+
+// Simple scripted player for headless runs: flicks the player towards the closest enemy
+// once a second and presses restart whenever the game is over
+SimInput botInput(const GameState& game, long tick) {
+    SimInput input = {game.player.playerPos, false, false};
+
+    if (game.isGameOver) {
+        input.mousePosition = {game.restartButton.x + game.restartButton.width / 2, game.restartButton.y + game.restartButton.height / 2};
+        input.mousePressed = (game.gameOverDelay <= 0);
+        return input;
+    }
+
+    long phase = tick % (long)FPS;
+    if (phase == 0) {
+        input.mousePressed = true;
+    }
+    else if (phase == 1 && enemyCount(game.enemies) > 0) {
+        int closest = 0;
+        for (int i = 0; i < enemyCount(game.enemies); i++) {
+            if (Vector2Distance(game.player.playerPos, (Vector2){game.enemies.x[i], game.enemies.y[i]}) <
+                Vector2Distance(game.player.playerPos, (Vector2){game.enemies.x[closest], game.enemies.y[closest]})) {
+                closest = i;
             }
+        }
+        Vector2 direction = Vector2Normalize(Vector2Subtract((Vector2){game.enemies.x[closest], game.enemies.y[closest]}, game.player.playerPos));
+        input.mousePosition = Vector2Subtract(game.mouseDragStart, Vector2Scale(direction, 300.0f));
+        input.mouseReleased = true;
+    }
+    return input;
+}
 
-            for (Enemy &enemy : enemies) {
-                UpdateAnimation(&enemy.animation, enemy, delta_time);
-                updateEnemy(enemy, playerBase.basePos, delta_time);
-                health(enemy, player1, playerBase, delta_time);
+// Runs the simulation without a window or audio device at a fixed timestep, as fast as possible
+// When recordFileName is given the session is saved for --replay
+int runHeadless(long ticks, unsigned int seed, const char* recordFileName) {
+    AnimationClip clips[CLIP_COUNT];
+    Texture2D noTexture = {0};
 
-                if (enemy.enemyHealth <= 0) {
-                    PlaySound(SFX5);
-                    enemy = createEnemy(screenWidth, screenHeight, playerBase.basePos, gruntAnim, sprinterAnim, heavyAnim);
-                    score += 10;
-                }
+    InitEnemyClips(clips, noTexture, noTexture, noTexture);
+
+    GameState game;
+    InputRecording recording;
+    initGame(game, clips, seed);
+
+    if (recordFileName != NULL) {
+        recording.seed = seed;
+        game.recording = &recording;
+    }
+
+    int restarts = 0;
+    auto start = std::chrono::steady_clock::now();
+
+    for (long tick = 0; tick < ticks; tick++) {
+        bool wasGameOver = game.isGameOver;
+        stepGame(game, botInput(game, tick), TIMESTEP);
+        if (wasGameOver && !game.isGameOver) restarts++;
+    }
+
+    auto end = std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration<double>(end - start).count();
+
+    printf("ticks: %ld  seed: %u\n", ticks, seed);
+    printf("time: %.3f s  (%.0f ticks/s, %.3f us/tick)\n", seconds, ticks / seconds, seconds * 1e6 / ticks);
+    printf("score: %d  highscore: %d  restarts: %d  enemies: %d  power-ups: %d\n",
+           game.score, game.highscore, restarts, enemyCount(game.enemies), game.powerUps.count);
+
+    if (recordFileName != NULL) {
+        recording.ticks = game.tick;
+        recording.finalScore = game.score;
+        recording.finalHighscore = game.highscore;
+        if (!saveRecording(recordFileName, recording)) return 1;
+    }
+
+    return 0;
+}
+
+// Plays a recorded session again without window or audio, as fast as possible, reporting
+// tick times and whether the final scores match the recorded ones
+int runReplay(const char* fileName) {
+    InputRecording recording;
+    if (!loadRecording(fileName, recording)) {
+        printf("could not load recording: %s\n", fileName);
+        return 1;
+    }
+    if (recording.ticks == 0) {
+        printf("recording has no ticks: %s\n", fileName);
+        return 1;
+    }
+
+    AnimationClip clips[CLIP_COUNT];
+    Texture2D noTexture = {0};
+
+    InitEnemyClips(clips, noTexture, noTexture, noTexture);
+
+    GameState game;
+    initGame(game, clips, recording.seed);
+
+    size_t next = 0;
+    double slowestTick = 0.0;
+    auto start = std::chrono::steady_clock::now();
+
+    for (unsigned int tick = 0; tick < recording.ticks; tick++) {
+        SimInput input = {Vector2Zero(), false, false};
+        if (next < recording.records.size() && recording.records[next].tick == tick) {
+            const InputRecord& record = recording.records[next++];
+            input = {record.mousePosition, (record.flags & RECORD_PRESSED) != 0, (record.flags & RECORD_RELEASED) != 0};
+        }
+
+        auto tickStart = std::chrono::steady_clock::now();
+        game.events = 0;
+        tickGame(game, input);
+        slowestTick = std::max(slowestTick, std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - tickStart).count());
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    bool matches = (game.score == recording.finalScore) && (game.highscore == recording.finalHighscore);
+
+    printf("replay: %s  ticks: %u  clicks: %zu  seed: %u\n", fileName, recording.ticks, recording.records.size(), recording.seed);
+    printf("time: %.3f s  (%.0f ticks/s, %.3f us/tick, slowest %.3f us)\n", seconds, recording.ticks / seconds, seconds * 1e6 / recording.ticks, slowestTick);
+    printf("score: %d  highscore: %d  %s\n", game.score, game.highscore, matches ? "(matches recording)" : "(DIFFERS from recording)");
+
+    return matches ? 0 : 2;
+}
+
+// Times updateEnemies alone on a large enemy set
+int runEnemyBenchmark(int count, int ticks) {
+    Vector2 target = {SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2};
+
+    RandomGenerator rng;
+    SetRandomGeneratorSeed(&rng, 1);
+
+    SpawnSampler spawnArea;
+    initSpawnSampler(spawnArea, 30, SCREEN_WIDTH - 30, 30, SCREEN_HEIGHT - 30, target, SPAWN_SAFE_DISTANCE);
+
+    Enemies enemies;
+    spawnEnemies(enemies, count, spawnArea, &rng);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int tick = 0; tick < ticks; tick++) {
+        updateEnemies(enemies, target, TIMESTEP);
+    }
+    auto end = std::chrono::steady_clock::now();
+    double ms = std::chrono::duration<double, std::milli>(end - start).count();
+
+#if defined(__AVX__)
+    const char* path = "AVX (8 wide)";
+#elif defined(__SSE2__)
+    const char* path = "SSE (4 wide)";
+#else
+    const char* path = "scalar";
+#endif
+    printf("enemies: %d  ticks: %d  path: %s\n", count, ticks, path);
+    printf("%.4f ms/tick  (%.2f ns/enemy)  check: %.3f\n", ms / ticks, ms * 1e6 / ((double)ticks * count), enemies.x[0] + enemies.y[count - 1]);
+
+    return 0;
+}
+
+// Draws count animated enemy sprites per frame with no frame limit and reports the CPU frame time and
+// the part spent flushing the render batch. "interleaved" streams the batch through persistently mapped buffers,
+// "instanced" hands all sprites to DrawSprites() (one instanced draw call per texture)
+enum SpriteBenchMode { SPRITES_SEPARATE, SPRITES_INTERLEAVED, SPRITES_INSTANCED };
+
+int runSpriteBenchmark(int count, int frames, SpriteBenchMode mode) {
+    const char* modeNames[] = {"separate", "interleaved", "instanced"};
+    if (mode == SPRITES_INTERLEAVED) SetConfigFlags(FLAG_BATCH_STREAM_HINT);
+    InitWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "SQUARE OFF - sprite benchmark");
+
+    Texture2D sprinterSprite = LoadTexture("SPRINTER.png");
+    AnimationClip clips[CLIP_COUNT];
+    InitEnemyClips(clips, sprinterSprite, sprinterSprite, sprinterSprite);
+    const AnimationClip& clip = clips[CLIP_SPRINTER];
+
+    RandomGenerator rng;
+    SetRandomGeneratorSeed(&rng, 1);
+
+    std::vector<Vector2> positions(count);
+    for (Vector2& position : positions) {
+        position = {GetRandomFloatFrom(&rng, 0, SCREEN_WIDTH - 16), GetRandomFloatFrom(&rng, 0, SCREEN_HEIGHT - 18)};
+    }
+
+    std::vector<SpriteInstance> sprites(count);
+    std::vector<ProfileZone> zones(16384);
+    double frameMs = 0.0, flushMs = 0.0, waitMs = 0.0, spritesMs = 0.0;
+    int flushes = 0;
+
+    const int warmupFrames = 10;
+    for (int frame = 0; frame < warmupFrames + frames; frame++) {
+        unsigned long long frameStart = GetProfileTime();
+
+        BeginDrawing();
+        ClearBackground(BLACK);
+        if (mode == SPRITES_INSTANCED) {
+            for (int i = 0; i < count; i++) {
+                Rectangle frameRec = clip.frames[(i + frame / 6) % clip.frameCount];
+                sprites[i] = {clip.spriteSheet, frameRec, {positions[i].x, positions[i].y, frameRec.width, frameRec.height}, {0, 0}, 0.0f, WHITE};
+            }
+            DrawSprites(sprites.data(), count);
+        }
+        else {
+            for (int i = 0; i < count; i++) {
+                DrawTextureRec(clip.spriteSheet, clip.frames[(i + frame / 6) % clip.frameCount], positions[i], WHITE);
             }
+        }
+        EndDrawing();
 
-            if (score > highscore) {
-                highscore = score;
+        if (frame < warmupFrames) {
+            rlResetBatchStats();
+            continue;
+        }
+
+        frameMs += (GetProfileTime() - frameStart) * 1e-6;
+        int zoneCount = GetProfileZones(zones.data(), (int)zones.size(), frameStart);
+        for (int z = 0; z < zoneCount; z++) {
+            if (strcmp(zones[z].name, "rlDrawRenderBatch") == 0) {
+                flushMs += (zones[z].end - zones[z].start) * 1e-6;
+                flushes++;
+            }
+            else if (strcmp(zones[z].name, "rlWaitStreamBuffer") == 0) {
+                waitMs += (zones[z].end - zones[z].start) * 1e-6;
             }
+            else if (strcmp(zones[z].name, "DrawSprites") == 0) {
+                spritesMs += (zones[z].end - zones[z].start) * 1e-6;
+            }
+        }
+    }
+
+    printf("sprites: %d  frames: %d  mode: %s\n", count, frames, modeNames[mode]);
+    printf("%.3f ms/frame  batch flush: %.3f ms/frame (%.1f flushes/frame)  of which waiting on fences: %.3f ms/frame\n",
+           frameMs / frames, flushMs / frames, (float)flushes / frames, waitMs / frames);
+    if (mode == SPRITES_INSTANCED) printf("DrawSprites: %.3f ms/frame\n", spritesMs / frames);
+    rlBatchStats batchStats = rlGetBatchStats();
+    printf("%.1f draw calls/frame  %.1f vertices/frame  %.1f KB uploaded/frame  vertex buffer full: %.1f/frame\n",
+           (float)batchStats.drawCalls / frames, (float)batchStats.vertices / frames, batchStats.bytesUploaded / 1024.0f / frames,
+           (float)batchStats.vertexOverflows / frames);
+
+    UnloadTexture(sprinterSprite);
+    CloseWindow();
+
+    return 0;
+}
+
+// Records sprites [first, last) as rotated quads, on whichever thread calls it
+void recordSprites(const AnimationClip& clip, const std::vector<Vector2>& positions, int first, int last, int frame) {
+    PROFILE_SCOPE("recordSprites");
+    for (int i = first; i < last; i++) {
+        Rectangle frameRec = clip.frames[(i + frame / 6) % clip.frameCount];
+        Rectangle dest = {positions[i].x, positions[i].y, frameRec.width, frameRec.height};
+        DrawTexturePro(clip.spriteSheet, frameRec, dest, {frameRec.width / 2, frameRec.height / 2}, (float)((i + frame) % 360), WHITE);
+    }
+}
+
+// Worker threads started once and woken every frame, each runs record(worker, frame) when its index is below active
+struct RecordWorkers {
+    std::vector<std::thread> threads;
+    std::mutex mutex;
+    std::condition_variable started;
+    std::condition_variable finished;
+    unsigned int generation = 0;            // bumped once per frame
+    int active = 0;                         // workers recording this frame
+    int pending = 0;                        // active workers not done yet
+    int frame = 0;
+    bool exit = false;
+};
 
-            if (GetRandomValue(0, 1000) < 5) { // Adjust the probability as needed
-                powerUps.push_back(createPowerUp(screenWidth, screenHeight));
+template <typename Record>
+void startRecordWorkers(RecordWorkers& workers, int count, Record record) {
+    for (int t = 0; t < count; t++) {
+        workers.threads.emplace_back([&workers, record, t]() {
+            std::unique_lock<std::mutex> lock(workers.mutex);
+            unsigned int seen = 0;
+
+            while (true) {
+                workers.started.wait(lock, [&] { return workers.exit || workers.generation != seen; });
+                if (workers.exit) return;
+                seen = workers.generation;
+                if (t >= workers.active) continue;
+
+                int frame = workers.frame;
+                lock.unlock();
+                record(t, frame);
+                lock.lock();
+
+                if (--workers.pending == 0) workers.finished.notify_one();
             }
+        });
+    }
+}
+
+// Runs the first active workers on frame and waits for all of them
+void runRecordWorkers(RecordWorkers& workers, int active, int frame) {
+    std::unique_lock<std::mutex> lock(workers.mutex);
+    workers.active = active;
+    workers.pending = active;
+    workers.frame = frame;
+    workers.generation++;
+    workers.started.notify_all();
+    workers.finished.wait(lock, [&] { return workers.pending == 0; });
+}
+
+void stopRecordWorkers(RecordWorkers& workers) {
+    {
+        std::lock_guard<std::mutex> lock(workers.mutex);
+        workers.exit = true;
+    }
+    workers.started.notify_all();
+    for (std::thread& thread : workers.threads) thread.join();
+    workers.threads.clear();
+}
 
-            for (auto it = powerUps.begin(); it != powerUps.end(); /* no increment here */) {
-                if (CheckCollisionCircleRec(player1.playerPos, player1.radius, {it->position.x, it->position.y, 10, 10})) {
-                    PlaySound(SFX3);
-                    applyPowerUp(player1, playerBase, enemies, *it);
-                    it = powerUps.erase(it);
-                } else {
-                    it++;
+// Draws count rotated sprites per frame, first straight from the main thread and then split across 1, 2, 4...
+// up to maxThreads worker threads that record into their own rlgl command buffers, submitted in order by the main thread.
+// Reports the vertex generation time (drawing or recording plus submitting) without the batch flushes
+int runRecordBenchmark(int count, int frames, int maxThreads) {
+    InitWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "SQUARE OFF - command recording benchmark");
+
+    Texture2D sprinterSprite = LoadTexture("SPRINTER.png");
+    AnimationClip clips[CLIP_COUNT];
+    InitEnemyClips(clips, sprinterSprite, sprinterSprite, sprinterSprite);
+    const AnimationClip& clip = clips[CLIP_SPRINTER];
+
+    RandomGenerator rng;
+    SetRandomGeneratorSeed(&rng, 1);
+
+    std::vector<Vector2> positions(count);
+    for (Vector2& position : positions) {
+        position = {GetRandomFloatFrom(&rng, 0, SCREEN_WIDTH), GetRandomFloatFrom(&rng, 0, SCREEN_HEIGHT)};
+    }
+
+    std::vector<rlCommandBuffer> buffers;
+    for (int t = 0; t < maxThreads; t++) buffers.push_back(rlLoadCommandBuffer(4 * count / maxThreads + 4));
+
+    // 0 threads draws straight into the render batch, as the game does
+    std::vector<int> threadCounts = {0};
+    for (int threads = 1; threads < maxThreads; threads *= 2) threadCounts.push_back(threads);
+    threadCounts.push_back(maxThreads);
+
+    printf("sprites: %d  frames: %d  cores: %u\n", count, frames, std::thread::hardware_concurrency());
+
+    std::vector<ProfileZone> zones(16384);
+    double immediateMs = 0.0;
+    const int warmupFrames = 10;
+    int threads = 0;
+
+    // Started once, so the record time does not include spawning threads
+    RecordWorkers workers;
+    startRecordWorkers(workers, maxThreads, [&](int t, int frame) {
+        rlBeginCommandBuffer(&buffers[t]);
+        recordSprites(clip, positions, count * t / threads, count * (t + 1) / threads, frame);
+        rlEndCommandBuffer();
+    });
+
+    for (int threadCount : threadCounts) {
+        double recordMs = 0.0, submitMs = 0.0, flushMs = 0.0;
+        threads = threadCount;
+
+        for (int frame = 0; frame < warmupFrames + frames; frame++) {
+            BeginDrawing();
+            ClearBackground(BLACK);
+
+            unsigned long long recordStart = GetProfileTime();
+
+            if (threads == 0) recordSprites(clip, positions, 0, count, frame);
+            else runRecordWorkers(workers, threads, frame);
+
+            unsigned long long recordEnd = GetProfileTime();
+            for (int t = 0; t < threads; t++) rlSubmitCommandBuffer(&buffers[t]);
+            unsigned long long submitEnd = GetProfileTime();
+
+            EndDrawing();
+
+            if (frame < warmupFrames) continue;
+
+            recordMs += (recordEnd - recordStart) * 1e-6;
+            submitMs += (submitEnd - recordEnd) * 1e-6;
+
+            // Batch flushes made while drawing or submitting, the one in EndDrawing() is left out
+            int zoneCount = GetProfileZones(zones.data(), (int)zones.size(), recordStart);
+            for (int z = 0; z < zoneCount; z++) {
+                if (zones[z].end <= submitEnd && strcmp(zones[z].name, "rlDrawRenderBatch") == 0) {
+                    flushMs += (zones[z].end - zones[z].start) * 1e-6;
                 }
             }
+        }
 
-            for (auto it = powerUps.begin(); it != powerUps.end(); /* no increment here */) {
-                it->duration -= delta_time;
-                if (it->duration <= 0.0f) {
-                    it = powerUps.erase(it);
-                } else {
-                    it++;
-                }
+        double generateMs = recordMs + submitMs - flushMs;
+        if (threads == 0) {
+            immediateMs = generateMs;
+            printf("immediate    draw: %.3f ms/frame  batch flush: %.3f ms/frame\n", recordMs / frames, flushMs / frames);
+        }
+        else {
+            printf("threads: %2d  record: %.3f ms/frame  submit: %.3f ms/frame  batch flush: %.3f ms/frame  (%.2fx vertex generation)\n",
+                   threads, recordMs / frames, submitMs / frames, flushMs / frames, immediateMs / generateMs);
+        }
+    }
+
+    stopRecordWorkers(workers);
+    for (rlCommandBuffer& buffer : buffers) rlUnloadCommandBuffer(buffer);
+    UnloadTexture(sprinterSprite);
+    CloseWindow();
+
+    return 0;
+}
+
+// Draws count enemies per frame the way a naive render loop does, each one a sprite from one of the three
+// separate sheets, a health bar and a label, first in submission order and then through the rlgl draw queue
+// with sprites, bars and labels on their own layers. Reports frame time and draw calls of both
+int runQueueBenchmark(int count, int frames) {
+    InitWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "SQUARE OFF - draw queue benchmark");
+
+    Texture2D gruntSprite = LoadTexture("GRUNT.png");
+    Texture2D sprinterSprite = LoadTexture("SPRINTER.png");
+    Texture2D heavySprite = LoadTexture("HEAVY.png");
+    AnimationClip clips[CLIP_COUNT];
+    InitEnemyClips(clips, gruntSprite, sprinterSprite, heavySprite);
+
+    RandomGenerator rng;
+    SetRandomGeneratorSeed(&rng, 1);
+
+    std::vector<Vector2> positions(count);
+    for (Vector2& position : positions) {
+        position = {GetRandomFloatFrom(&rng, 0, SCREEN_WIDTH - 16), GetRandomFloatFrom(&rng, 0, SCREEN_HEIGHT - 18)};
+    }
+
+    printf("enemies: %d  frames: %d\n", count, frames);
+
+    const int warmupFrames = 10;
+    for (int queued = 0; queued < 2; queued++) {
+        if (queued) rlEnableDrawQueue();
+        double frameMs = 0.0;
+
+        for (int frame = 0; frame < warmupFrames + frames; frame++) {
+            unsigned long long frameStart = GetProfileTime();
+
+            BeginDrawing();
+            ClearBackground(BLACK);
+            for (int i = 0; i < count; i++) {
+                const AnimationClip& clip = clips[CLIP_GRUNT + i % 3];
+                rlSetDrawLayer(0);
+                DrawTextureRec(clip.spriteSheet, clip.frames[(i + frame / 6) % clip.frameCount], positions[i], WHITE);
+                rlSetDrawLayer(1);
+                DrawRectangle(positions[i].x, positions[i].y - 4, 16, 2, RED);
+                rlSetDrawLayer(2);
+                DrawText("E", positions[i].x + 18, positions[i].y, 10, WHITE);
             }
+            EndDrawing();
 
-            for (const PowerUp &powerUp : powerUps) {
-                // Draw different shapes or symbols based on the power-up type
-                switch (powerUp.type) {
-                    case HEAL_BASE:
-                        DrawCircleV(powerUp.position, 10, GREEN); // Green circle for heal
-                        break;
-                    case UP_PLAYER_SIZE:
-                        if (player1.radius <= 40.0f){
-                            DrawRectangleV(Vector2{ powerUp.position.x - 5, powerUp.position.y - 5 }, Vector2{ 20, 20 }, BLUE);
-                        }
-                        break;
-                    case INCREASE_SCORE1:
-                        DrawTriangle({ powerUp.position.x - 5, powerUp.position.y + 5 }, { powerUp.position.x + 5, powerUp.position.y + 5 }, { powerUp.position.x, powerUp.position.y - 5 }, PURPLE); // Purple triangle for immunity
-                        break;
-                    case SLOW:
-                        DrawLineV({ powerUp.position.x - 5, powerUp.position.y - 5 }, { powerUp.position.x + 5, powerUp.position.y + 5 }, ORANGE); 
-                        DrawLineV({ powerUp.position.x - 5, powerUp.position.y + 5 }, { powerUp.position.x + 5, powerUp.position.y - 5 }, ORANGE);
-                        break;
-                }
+            if (frame < warmupFrames) {
+                rlResetBatchStats();
+                continue;
             }
-        }        
+            frameMs += (GetProfileTime() - frameStart) * 1e-6;
+        }
 
-        BeginDrawing();
-        ClearBackground(BLACK);
+        rlBatchStats batchStats = rlGetBatchStats();
+        printf("%s  %.3f ms/frame  %.1f draw calls/frame  %.1f texture changes/frame\n", queued ? "queued   " : "immediate",
+               frameMs / frames, (float)batchStats.drawCalls / frames, (float)batchStats.textureChanges / frames);
+        if (queued) rlDisableDrawQueue();
+    }
 
-        // DrawCircle(screenWidth / 2, screenHeight / 2, 75.0f, YELLOW); // Base
-        DrawCircleV(player1.playerPos, player1.radius, RED);
+    UnloadTexture(gruntSprite);
+    UnloadTexture(sprinterSprite);
+    UnloadTexture(heavySprite);
+    CloseWindow();
+
+    return 0;
+}
 
-        if (playerBase.health > 0) {
-            DrawCircleLines(playerBase.basePos.x, playerBase.basePos.y, playerBase.radius, RED);
-        
-            DrawHealthBar(playerBase.basePos.x - playerBase.radius, playerBase.basePos.y + playerBase.radius + 10, playerBase.radius * 2, 10, playerBase.health, 3, RED, BLACK);
+// Keeps count sounds playing at once and times the audio thread callback through its profiler zone.
+// Sounds are restarted as soon as they end, so every callback mixes all of them
+int runMixBenchmark(int count, float seconds, float pitch) {
+    InitAudioDevice();
+    if (!IsAudioDeviceReady()) return 1;
+
+    // One second of stereo noise, converted once to the device format by LoadSoundFromWave()
+    RandomGenerator rng;
+    SetRandomGeneratorSeed(&rng, 1);
+    Wave wave = {48000, 48000, 32, 2, MemAlloc(48000 * 2 * sizeof(float))};
+    for (unsigned int i = 0; i < wave.frameCount * wave.channels; i++) ((float*)wave.data)[i] = GetRandomFloatFrom(&rng, -0.01f, 0.01f);
+
+    std::vector<Sound> sounds(count);
+    for (Sound& sound : sounds) {
+        sound = LoadSoundFromWave(wave);
+        SetSoundPitch(sound, pitch);
+    }
+    UnloadWave(wave);
+
+    printf("voices: %d  seconds: %.1f  pitch: %.2f\n", count, seconds, pitch);
+
+    const auto warmup = std::chrono::milliseconds(500);
+    auto start = std::chrono::steady_clock::now();
+    unsigned long long measureStart = 0;
+    while (std::chrono::steady_clock::now() - start < warmup + std::chrono::duration<float>(seconds)) {
+        if (measureStart == 0 && std::chrono::steady_clock::now() - start >= warmup) measureStart = GetProfileTime();
+        for (Sound& sound : sounds) {
+            if (!IsSoundPlaying(sound)) PlaySound(sound);
         }
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
 
-        // if (player1.isDragging) {
-        //     //Vector2 mouse_drag_vector = Vector2Scale(shot_dir, shot_vector_distance);
-        //     //DrawLineEx(mouse_drag_start, mouse_drag_end, 2, RED);
-        // }
+    std::vector<ProfileZone> zones(PROFILE_OVERLAY_MAX_ZONES);
+    int zoneCount = GetProfileZones(zones.data(), (int)zones.size(), measureStart);
+    int callbacks = 0;
+    double mixMs = 0.0;
+    for (int i = 0; i < zoneCount; i++) {
+        if (strcmp(zones[i].name, "OnSendAudioDataToDevice") != 0) continue;
+        callbacks++;
+        mixMs += (zones[i].end - zones[i].start) * 1e-6;
+    }
 
-        for (const Enemy &enemy : enemies) {
-            if (enemy.enemyHealth > 0) {
-                drawEnemy(enemy);
-            }
+    if (callbacks > 0) {
+        printf("callbacks: %d  %.1f us/callback  %.1f voices mixed/ms\n", callbacks, mixMs * 1000.0 / callbacks, (double)count * callbacks / mixMs);
+    }
+
+    for (Sound& sound : sounds) UnloadSound(sound);
+    CloseAudioDevice();
+
+    return 0;
+}
+
+// Writes the profiler zones still held in the per-thread rings when a file was asked for
+int exportProfile(int result, const char* profileFileName) {
+    if (profileFileName != NULL && !ExportProfileTrace(profileFileName) && result == 0) return 1;
+    return result;
+}
+
+int main(int argc, char* argv[]) {
+    // Usage: out [mode] --profile file, taken out of argv so every mode below accepts it
+    const char* profileFileName = NULL;
+    for (int i = 1; i + 1 < argc; i++) {
+        if (strcmp(argv[i], "--profile") == 0) {
+            profileFileName = argv[i + 1];
+            for (int j = i; j + 2 <= argc; j++) argv[j] = argv[j + 2];
+            argc -= 2;
+            break;
         }
-        
-        DrawText(TextFormat("Score: %d", score), 30, 30, 20, WHITE);
-
-        if (isGameOver && gameOverDelay <= 0) {
-            // Draw game over message
-            DrawText("Game Over", screenWidth / 2 - MeasureText("Game Over", 20) / 2, screenHeight / 2, 20, WHITE);
-            DrawText(TextFormat("High Score: %d", highscore), screenWidth / 2 - MeasureText("High Score: ", 20) / 2, screenHeight / 2 + 20, 20, WHITE);
-            DrawRectangleRec(restartButton, GRAY);
-            DrawText("Restart", restartButton.x + 10, restartButton.y + 5, 20, BLACK);
-
-            if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
-                Vector2 mousePosition = GetMousePosition();
-                if (CheckCollisionPointRec(mousePosition, restartButton)) {
-                    score = 0;
-                    playerBase.health = 3;
-                    player1.playerPos = {screenWidth / 2.0f, screenHeight / 2.0f};
-                    isGameOver = false;
-                    gameOverDelay = 1.0f;
-                    spawnTimer = 0.0f;
-                    player1.velocity = {0, 0};
-                    player1.acceleration = {0, 0};
-                    player1.radius = 20.0f;
-                    gameOverSoundPlayed = false;
-                    enemies.clear();
-                    for (int i = 0; i < 3; ++i) {
-                        enemies.push_back(createEnemy(screenWidth, screenHeight, playerBase.basePos, gruntAnim, sprinterAnim, heavyAnim));
-                    }
-                }
-            }
+    }
+
+    // Usage: out --headless [ticks] [seed] [record file]
+    if (argc > 1 && strcmp(argv[1], "--headless") == 0) {
+        long ticks = (argc > 2) ? atol(argv[2]) : 100000;
+        unsigned int seed = (argc > 3) ? (unsigned int)strtoul(argv[3], NULL, 10) : 1;
+        if (ticks <= 0) {
+            printf("ticks must be at least 1\n");
+            return 1;
+        }
+        return exportProfile(runHeadless(ticks, seed, (argc > 4) ? argv[4] : NULL), profileFileName);
+    }
+
+    // Usage: out --replay file
+    if (argc > 2 && strcmp(argv[1], "--replay") == 0) {
+        return exportProfile(runReplay(argv[2]), profileFileName);
+    }
+
+    // Usage: out --bench-enemies [count] [ticks]
+    if (argc > 1 && strcmp(argv[1], "--bench-enemies") == 0) {
+        int count = (argc > 2) ? atoi(argv[2]) : 100000;
+        int ticks = (argc > 3) ? atoi(argv[3]) : 1000;
+        return exportProfile(runEnemyBenchmark(count, ticks), profileFileName);
+    }
+
+    // Usage: out --bench-sprites [count] [frames] [separate|interleaved|instanced]
+    if (argc > 1 && strcmp(argv[1], "--bench-sprites") == 0) {
+        int count = (argc > 2) ? atoi(argv[2]) : 50000;
+        int frames = (argc > 3) ? atoi(argv[3]) : 300;
+        SpriteBenchMode mode = SPRITES_SEPARATE;
+        if (argc > 4 && strcmp(argv[4], "interleaved") == 0) mode = SPRITES_INTERLEAVED;
+        if (argc > 4 && strcmp(argv[4], "instanced") == 0) mode = SPRITES_INSTANCED;
+        return exportProfile(runSpriteBenchmark(count, frames, mode), profileFileName);
+    }
+
+    // Usage: out --bench-record [count] [frames] [max threads]
+    if (argc > 1 && strcmp(argv[1], "--bench-record") == 0) {
+        int count = (argc > 2) ? atoi(argv[2]) : 100000;
+        int frames = (argc > 3) ? atoi(argv[3]) : 100;
+        int maxThreads = (argc > 4) ? atoi(argv[4]) : (int)std::thread::hardware_concurrency();
+        return exportProfile(runRecordBenchmark(count, frames, std::max(1, maxThreads)), profileFileName);
+    }
+
+    // Usage: out --bench-queue [count] [frames]
+    if (argc > 1 && strcmp(argv[1], "--bench-queue") == 0) {
+        int count = (argc > 2) ? atoi(argv[2]) : 5000;
+        int frames = (argc > 3) ? atoi(argv[3]) : 100;
+        return exportProfile(runQueueBenchmark(count, frames), profileFileName);
+    }
+
+    // Usage: out --bench-mix [voices] [seconds] [pitch]
+    if (argc > 1 && strcmp(argv[1], "--bench-mix") == 0) {
+        int count = (argc > 2) ? atoi(argv[2]) : 32;
+        float seconds = (argc > 3) ? (float)atof(argv[3]) : 5.0f;
+        float pitch = (argc > 4) ? (float)atof(argv[4]) : 1.0f;
+        return exportProfile(runMixBenchmark(count, seconds, pitch), profileFileName);
+    }
+
+    // Usage: out --startup-time [serial], exits after the first frame; serial decodes every asset on the main thread
+    bool measureStartup = (argc > 1 && strcmp(argv[1], "--startup-time") == 0);
+    bool serialLoading = (measureStartup && argc > 2 && strcmp(argv[2], "serial") == 0);
+    unsigned long long startupBegin = GetProfileTime();
+
+    // Sounds and sprite sheets decode on worker threads while the audio device and window open,
+    // the main thread only creates the sound buffers and uploads the atlas. One core is left to it
+    AssetLoader loader;
+    int cores = (int)std::max(1u, std::thread::hardware_concurrency());
+    InitAssetLoader(loader, serialLoading ? 0 : cores - 1);
+    AssetJob sfxJobs[6] = {
+        LoadWaveAsync(loader, "ShootSFX.ogg"),
+        LoadWaveAsync(loader, "DieSFX.ogg"),
+        LoadWaveAsync(loader, "PowerupSFX.ogg"),
+        LoadWaveAsync(loader, "WallHitSFX.ogg"),
+        LoadWaveAsync(loader, "KillSFX.ogg"),
+        LoadWaveAsync(loader, "HeavyDMGSFX.ogg"),
+    };
+    AssetJob sheetJobs[3] = {
+        LoadImageAsync(loader, "GRUNT.png"),
+        LoadImageAsync(loader, "SPRINTER.png"),
+        LoadImageAsync(loader, "HEAVY.png"),
+    };
+
+    InitAudioDevice();
+
+    // Background music is decoded a buffer at a time on raylib's music decoding thread instead of fully up front
+    Music BGM = LoadMusicStream("BGM.ogg");
+    SetMusicVolume(BGM, 0.7f);
+    SetMusicStreamAutoUpdate(BGM, true);
+    PlayMusicStream(BGM);
+
+    AnimationClip clips[CLIP_COUNT];
+
+    InitWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "SQUARE OFF");
+    SetTargetFPS(60); // Set the target frame rate
+    SetDrawCulling(true); // Skip shapes and sprites that end up outside the window
+    rlEnableDrawQueue();  // Group draws by texture and mode inside each DrawLayer
+
+    Sound SFX1 = WaitSound(loader, sfxJobs[0]);
+    Sound SFX2 = WaitSound(loader, sfxJobs[1]);
+    Sound SFX3 = WaitSound(loader, sfxJobs[2]);
+    Sound SFX4 = WaitSound(loader, sfxJobs[3]);
+    Sound SFX5 = WaitSound(loader, sfxJobs[4]);
+    Sound SFX6 = WaitSound(loader, sfxJobs[5]);
+    SetSoundMaxVoices(SFX1, 3);
+    SetSoundMaxVoices(SFX4, 3);
+    SetSoundMaxVoices(SFX5, 6);
+
+    TextureAtlas enemyAtlas = LoadEnemyAtlas(clips, loader, sheetJobs);
+    CloseAssetLoader(loader);
+
+    // Usage: out --record file
+    const char* recordFileName = (argc > 2 && strcmp(argv[1], "--record") == 0) ? argv[2] : NULL;
+    InputRecording recording;
+    unsigned int seed = GetRandomBits(NULL);
+
+    GameState game;
+    initGame(game, clips, seed);
+
+    if (recordFileName != NULL) {
+        recording.seed = seed;
+        game.recording = &recording;
+    }
+
+    ProfileOverlay profileOverlay;
+    InitProfileOverlay(profileOverlay);
+    bool sdfShapes = false;
+    rlBatchStats frameBatchStats = {0};
+    StaticLayers staticLayers;
+    std::vector<SpriteInstance> sprites;
+
+    while (!WindowShouldClose()) {
+        PROFILE_SCOPE("frame");
+        float delta_time = GetFrameTime();
+        SimInput input = {GetMousePosition(), IsMouseButtonPressed(MOUSE_LEFT_BUTTON), IsMouseButtonReleased(MOUSE_LEFT_BUTTON)};
+
+        stepGame(game, input, delta_time);
+
+        // Sound effects layer on pooled voices instead of restarting themselves
+        if (game.events & EVENT_GAME_OVER) PlaySoundVoice(SFX2, 1.0f, 1.0f, 0.5f, PRIORITY_ALERT);
+        if (game.events & EVENT_WALL_HIT) PlaySoundVoice(SFX4, 1.0f, 1.0f, 0.5f, PRIORITY_FEEDBACK);
+        if (game.events & EVENT_SHOOT) PlaySoundVoice(SFX1, 1.0f, 1.0f, 0.5f, PRIORITY_FEEDBACK);
+        if (game.events & EVENT_BASE_HIT) PlaySoundVoice(SFX6, 1.0f, 1.0f, 0.5f, PRIORITY_ALERT);
+        for (int i = 0; i < game.kills; i++) PlaySoundVoice(SFX5, 1.0f, 1.0f + 0.06f*(i%3), 0.5f, PRIORITY_KILL); // Detuned so simultaneous kills don't just sum
+        if (game.events & EVENT_POWERUP) PlaySoundVoice(SFX3, 0.5f, 1.0f, 0.5f, PRIORITY_ALERT);
+
+        if (IsKeyPressed(KEY_F3)) profileOverlay.visible = !profileOverlay.visible;
+        if (IsKeyPressed(KEY_F4)) {
+            sdfShapes = !sdfShapes;
+            SetShapesMode(sdfShapes ? SHAPES_MODE_SDF : SHAPES_MODE_TESSELLATED);
         }
+        if (IsKeyPressed(KEY_F5)) staticLayers.enabled = !staticLayers.enabled;
+        UpdateProfileOverlay(profileOverlay);
 
+        BeginDrawing();
+        drawGame(game, sprites, staticLayers);
+        if (profileOverlay.visible) {
+            // Read before the overlay draws, so it only counts the game's own primitives
+            drawRenderStats(frameBatchStats, GetDrawCullStats(), SCREEN_WIDTH - 310, 10 + (int)(profileOverlay.rows.size() + 1) * 12 + 12);
+        }
+        DrawProfileOverlay(profileOverlay, SCREEN_WIDTH - 310, 10);
         EndDrawing();
+
+        // EndDrawing() flushed the batch, so the counters now cover the whole frame
+        frameBatchStats = rlGetBatchStats();
+        rlResetBatchStats();
+
+        if (measureStartup) {
+            printf("time to first frame: %.1f ms (%s loading)\n", (double)(GetProfileTime() - startupBegin)*1e-6, serialLoading ? "serial" : "parallel");
+            break;
+        }
     }
 
-    UnloadTexture(sprinterSprite);
-    UnloadTexture(gruntSprite);
-    UnloadTexture(heavySprite);
-    free(sprinterAnim.frames);
-    free(gruntAnim.frames);
-    free(heavyAnim.frames);
+    if (recordFileName != NULL) {
+        recording.ticks = game.tick;
+        recording.finalScore = game.score;
+        recording.finalHighscore = game.highscore;
+        saveRecording(recordFileName, recording);
+    }
 
-    UnloadSound(BGM);
+    unloadStaticLayers(staticLayers);
+    UnloadTextureAtlas(enemyAtlas);
+
+    UnloadMusicStream(BGM);
     UnloadSound(SFX1);
     UnloadSound(SFX2);
     UnloadSound(SFX3);
@@ -550,5 +1716,5 @@ int main() {
 
     CloseWindow();
 
-    return 0;
+    return exportProfile(0, profileFileName);
 }
@@ -0,0 +1,98 @@
+#ifndef POOL_H
+#define POOL_H
+
+#include <vector>
+
+// Refers to an item in a Pool. The generation changes every time the slot is freed,
+// so a handle kept after its item was removed is detected instead of reaching the next occupant
+struct PoolHandle {
+    int slot;
+    unsigned int generation;
+};
+
+// Fixed capacity object pool. Live items are kept packed in items[0, count) so iterating them
+// is a plain array walk, removal swaps the last item into the hole, and free slots are recycled
+// through a free list. Adding and removing are O(1) and never allocate after InitPool.
+// Removing an item moves the last one, so iterate backwards when removing during iteration.
+template <typename T>
+struct Pool {
+    std::vector<T> items;
+    std::vector<int> itemSlot;                  // slot owning each packed item
+    std::vector<int> slotItem;                  // packed index of each live slot
+    std::vector<unsigned int> slotGeneration;
+    std::vector<int> freeSlots;                 // stack of unused slots
+    int count;
+    int capacity;
+};
+
+template <typename T>
+void ClearPool(Pool<T>& pool) {
+    pool.freeSlots.clear();
+    for (int slot = pool.capacity - 1; slot >= 0; slot--) {
+        if (pool.slotItem[slot] >= 0) pool.slotGeneration[slot]++;
+        pool.slotItem[slot] = -1;
+        pool.freeSlots.push_back(slot);
+    }
+    pool.count = 0;
+}
+
+template <typename T>
+void InitPool(Pool<T>& pool, int capacity) {
+    pool.items.assign(capacity, T());
+    pool.itemSlot.assign(capacity, -1);
+    pool.slotItem.assign(capacity, -1);
+    pool.slotGeneration.assign(capacity, 0);
+    pool.freeSlots.reserve(capacity);
+    pool.capacity = capacity;
+    pool.count = 0;
+    ClearPool(pool);
+}
+
+// Returns a handle with slot -1 when the pool is full
+template <typename T>
+PoolHandle AddPoolItem(Pool<T>& pool, const T& item) {
+    if (pool.freeSlots.empty()) return (PoolHandle){-1, 0};
+
+    int slot = pool.freeSlots.back();
+    pool.freeSlots.pop_back();
+
+    pool.items[pool.count] = item;
+    pool.itemSlot[pool.count] = slot;
+    pool.slotItem[slot] = pool.count;
+    pool.count++;
+
+    return (PoolHandle){slot, pool.slotGeneration[slot]};
+}
+
+// Returns NULL if the handle's item was removed
+template <typename T>
+T* GetPoolItem(Pool<T>& pool, PoolHandle handle) {
+    if (handle.slot < 0 || handle.slot >= pool.capacity) return NULL;
+    if (pool.slotGeneration[handle.slot] != handle.generation || pool.slotItem[handle.slot] < 0) return NULL;
+    return &pool.items[pool.slotItem[handle.slot]];
+}
+
+// Removes the packed item at index, the last item takes its place
+template <typename T>
+void RemovePoolItemAt(Pool<T>& pool, int index) {
+    int slot = pool.itemSlot[index];
+    int last = pool.count - 1;
+
+    if (index != last) {
+        pool.items[index] = pool.items[last];
+        pool.itemSlot[index] = pool.itemSlot[last];
+        pool.slotItem[pool.itemSlot[index]] = index;
+    }
+
+    pool.slotItem[slot] = -1;
+    pool.slotGeneration[slot]++;
+    pool.freeSlots.push_back(slot);
+    pool.count--;
+}
+
+template <typename T>
+void RemovePoolItem(Pool<T>& pool, PoolHandle handle) {
+    if (GetPoolItem(pool, handle) != NULL) RemovePoolItemAt(pool, pool.slotItem[handle.slot]);
+}
+
+#endif // POOL_H
@@ -0,0 +1,112 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include "raylib.h"
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+// Records the enclosing scope as a profiler zone on the calling thread.
+// The name is kept by pointer, so pass a string literal
+struct ProfileScope {
+    explicit ProfileScope(const char* name) { BeginProfileZone(name); }
+    ~ProfileScope() { EndProfileZone(); }
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+};
+
+#define PROFILE_SCOPE_JOIN(a, b) a##b
+#define PROFILE_SCOPE_NAME(line) PROFILE_SCOPE_JOIN(profileScope, line)
+#define PROFILE_SCOPE(name) ProfileScope PROFILE_SCOPE_NAME(__LINE__)(name)
+
+struct ProfileOverlayRow {
+    const char* name;
+    unsigned int thread;
+    float msPerFrame;                       // total time inside the zone, averaged over the frames since last refresh
+    float callsPerFrame;
+};
+
+// Per-zone timings summed over every thread's profiler ring, refreshed a few times per second
+// so the numbers stay readable. Zones nested in others are counted in both
+struct ProfileOverlay {
+    bool visible;
+    int frames;                             // frames since the last refresh
+    unsigned long long lastRefresh;
+    std::vector<ProfileZone> zones;
+    std::vector<ProfileOverlayRow> rows;
+};
+
+const unsigned long long PROFILE_OVERLAY_REFRESH = 500000000ULL;    // ns
+const int PROFILE_OVERLAY_MAX_ZONES = 16384;
+
+inline void InitProfileOverlay(ProfileOverlay& overlay) {
+    overlay.visible = false;
+    overlay.frames = 0;
+    overlay.lastRefresh = GetProfileTime();
+    overlay.zones.resize(PROFILE_OVERLAY_MAX_ZONES);
+    overlay.rows.clear();
+}
+
+// Call once per frame, aggregates the zones ended since the last refresh
+inline void UpdateProfileOverlay(ProfileOverlay& overlay) {
+    overlay.frames++;
+
+    unsigned long long now = GetProfileTime();
+    if (now - overlay.lastRefresh < PROFILE_OVERLAY_REFRESH) return;
+
+    int count = GetProfileZones(overlay.zones.data(), (int)overlay.zones.size(), overlay.lastRefresh);
+    overlay.rows.clear();
+
+    for (int i = 0; i < count; i++) {
+        const ProfileZone& zone = overlay.zones[i];
+        ProfileOverlayRow* row = NULL;
+
+        for (ProfileOverlayRow& existing : overlay.rows) {
+            if (existing.thread == zone.thread && strcmp(existing.name, zone.name) == 0) {
+                row = &existing;
+                break;
+            }
+        }
+        if (row == NULL) {
+            overlay.rows.push_back((ProfileOverlayRow){zone.name, zone.thread, 0.0f, 0.0f});
+            row = &overlay.rows.back();
+        }
+
+        row->msPerFrame += (float)(zone.end - zone.start) * 1e-6f;
+        row->callsPerFrame += 1.0f;
+    }
+
+    for (ProfileOverlayRow& row : overlay.rows) {
+        row.msPerFrame /= overlay.frames;
+        row.callsPerFrame /= overlay.frames;
+    }
+
+    std::sort(overlay.rows.begin(), overlay.rows.end(), [](const ProfileOverlayRow& a, const ProfileOverlayRow& b) {
+        return (a.thread != b.thread) ? a.thread < b.thread : a.msPerFrame > b.msPerFrame;
+    });
+
+    overlay.frames = 0;
+    overlay.lastRefresh = now;
+}
+
+inline void DrawProfileOverlay(const ProfileOverlay& overlay, int x, int y) {
+    if (!overlay.visible) return;
+
+    const int fontSize = 10;
+    const int lineHeight = 12;
+
+    DrawRectangle(x, y, 300, (int)(overlay.rows.size() + 1) * lineHeight + 8, Fade(BLACK, 0.75f));
+    DrawText("zone                      thread   ms/frame  calls", x + 4, y + 4, fontSize, YELLOW);
+
+    for (size_t i = 0; i < overlay.rows.size(); i++) {
+        const ProfileOverlayRow& row = overlay.rows[i];
+        int rowY = y + 4 + (int)(i + 1) * lineHeight;
+
+        DrawText(row.name, x + 4, rowY, fontSize, WHITE);
+        DrawText(TextFormat("%u", row.thread), x + 150, rowY, fontSize, LIGHTGRAY);
+        DrawText(TextFormat("%.3f", row.msPerFrame), x + 190, rowY, fontSize, WHITE);
+        DrawText(TextFormat("%.1f", row.callsPerFrame), x + 250, rowY, fontSize, LIGHTGRAY);
+    }
+}
+
+#endif // PROFILER_H
@@ -0,0 +1,121 @@
+#ifndef SPATIAL_HASH_H
+#define SPATIAL_HASH_H
+
+#include "raylib.h"
+#include <algorithm>
+#include <vector>
+
+// Uniform grid over a fixed area, rebuilt once per tick from a set of bounding rectangles.
+// Items are bucketed with a counting sort so rebuilding does not allocate once the vectors
+// have grown to the working size. Items outside the area are clamped into the border cells.
+struct SpatialHash {
+    Rectangle area;
+    float cellSize;
+    int columns;
+    int rows;
+    std::vector<int> cellStart;             // columns*rows + 1 offsets into cellItems
+    std::vector<int> cellItems;             // item indices, grouped by cell
+    std::vector<Rectangle> itemCells;       // cell range covered by each item (x0, y0, x1, y1)
+    std::vector<unsigned int> itemStamp;    // last query that returned the item
+    unsigned int queryStamp;
+};
+
+inline void InitSpatialHash(SpatialHash& hash, Rectangle area, float cellSize) {
+    hash.area = area;
+    hash.cellSize = cellSize;
+    hash.columns = (int)(area.width / cellSize) + 1;
+    hash.rows = (int)(area.height / cellSize) + 1;
+    hash.cellStart.assign(hash.columns * hash.rows + 1, 0);
+    hash.cellItems.clear();
+    hash.itemCells.clear();
+    hash.itemStamp.clear();
+    hash.queryStamp = 0;
+}
+
+inline int SpatialHashCellX(const SpatialHash& hash, float x) {
+    int cell = (int)((x - hash.area.x) / hash.cellSize);
+    return (cell < 0) ? 0 : (cell >= hash.columns) ? hash.columns - 1 : cell;
+}
+
+inline int SpatialHashCellY(const SpatialHash& hash, float y) {
+    int cell = (int)((y - hash.area.y) / hash.cellSize);
+    return (cell < 0) ? 0 : (cell >= hash.rows) ? hash.rows - 1 : cell;
+}
+
+// Rebuilds the grid from count items, getBounds(i) must return the bounding rectangle of item i
+template <typename GetBounds>
+void BuildSpatialHash(SpatialHash& hash, int count, GetBounds getBounds) {
+    hash.itemCells.resize(count);
+    hash.itemStamp.assign(count, 0);
+    hash.queryStamp = 0;
+    std::fill(hash.cellStart.begin(), hash.cellStart.end(), 0);
+
+    // Count items per cell (shifted by one so the prefix sum gives start offsets)
+    for (int i = 0; i < count; i++) {
+        Rectangle bounds = getBounds(i);
+        Rectangle cells = {(float)SpatialHashCellX(hash, bounds.x), (float)SpatialHashCellY(hash, bounds.y),
+                           (float)SpatialHashCellX(hash, bounds.x + bounds.width), (float)SpatialHashCellY(hash, bounds.y + bounds.height)};
+        hash.itemCells[i] = cells;
+
+        for (int y = (int)cells.y; y <= (int)cells.height; y++) {
+            for (int x = (int)cells.x; x <= (int)cells.width; x++) {
+                hash.cellStart[y * hash.columns + x + 1]++;
+            }
+        }
+    }
+
+    for (size_t c = 1; c < hash.cellStart.size(); c++) {
+        hash.cellStart[c] += hash.cellStart[c - 1];
+    }
+
+    hash.cellItems.resize(hash.cellStart.back());
+
+    // Scatter, using cellStart[c] as the write cursor of cell c - 1 and shifting back afterwards
+    for (int i = 0; i < count; i++) {
+        Rectangle cells = hash.itemCells[i];
+        for (int y = (int)cells.y; y <= (int)cells.height; y++) {
+            for (int x = (int)cells.x; x <= (int)cells.width; x++) {
+                hash.cellItems[hash.cellStart[y * hash.columns + x]++] = i;
+            }
+        }
+    }
+
+    for (size_t c = hash.cellStart.size() - 1; c > 0; c--) {
+        hash.cellStart[c] = hash.cellStart[c - 1];
+    }
+    hash.cellStart[0] = 0;
+}
+
+// Fills results with every item whose cells overlap the query area, each item at most once.
+// Candidates still need an exact collision test, returns the number of candidates found
+inline int QuerySpatialHash(SpatialHash& hash, Rectangle query, std::vector<int>& results) {
+    results.clear();
+    hash.queryStamp++;
+
+    int x0 = SpatialHashCellX(hash, query.x);
+    int y0 = SpatialHashCellY(hash, query.y);
+    int x1 = SpatialHashCellX(hash, query.x + query.width);
+    int y1 = SpatialHashCellY(hash, query.y + query.height);
+
+    for (int y = y0; y <= y1; y++) {
+        for (int x = x0; x <= x1; x++) {
+            int cell = y * hash.columns + x;
+            for (int k = hash.cellStart[cell]; k < hash.cellStart[cell + 1]; k++) {
+                int item = hash.cellItems[k];
+                if (hash.itemStamp[item] != hash.queryStamp) {
+                    hash.itemStamp[item] = hash.queryStamp;
+                    results.push_back(item);
+                }
+            }
+        }
+    }
+
+    return (int)results.size();
+}
+
+// True if item was among the results of the most recent query
+inline bool InLastSpatialHashQuery(const SpatialHash& hash, int item) {
+    return hash.queryStamp != 0 && hash.itemStamp[item] == hash.queryStamp;
+}
+
+#endif // SPATIAL_HASH_H
@@ -70,6 +70,9 @@
 // By default EndDrawing() does this job: draws everything + SwapScreenBuffer() + manage frame timing + PollInputEvents()
 // Enabling this flag allows manual control of the frame processes, use at your own risk
 //#define SUPPORT_CUSTOM_FRAME_CONTROL    1
+// Support 2D draw culling, shapes and textures outside the visible area are not added to the render batch
+// NOTE: Disabled by default at runtime, enable it with SetDrawCulling(true)
+#define SUPPORT_DRAW_CULLING            1
 
 // rcore: Configuration values
 //------------------------------------------------------------------------------------
@@ -137,6 +140,11 @@
 // Some lines-based shapes could still use lines
 #define SUPPORT_QUADS_DRAW_MODE         1
 
+// rshapes: Configuration values
+//------------------------------------------------------------------------------------
+#define MAX_CIRCLE_SEGMENTS          1024       // Maximum segments per circle/arc, larger values are clamped
+#define MAX_CIRCLE_TABLES              16       // Unit circle tables cached, one per segments/arc pair
+
 
 //------------------------------------------------------------------------------------
 // Module: rtextures - Configuration Flags
@@ -166,6 +174,10 @@
 // If not defined, still some functions are supported: ImageFormat(), ImageCrop(), ImageToPOT()
 #define SUPPORT_IMAGE_MANIPULATION      1
 
+// rtextures: Configuration values
+//------------------------------------------------------------------------------------
+#define MAX_TEXTURE_ATLAS_SIZE       8192       // Maximum texture atlas width/height: BuildTextureAtlas()
+
 
 //------------------------------------------------------------------------------------
 // Module: rtext - Configuration Flags
@@ -225,7 +237,10 @@
 #define AUDIO_DEVICE_CHANNELS              2    // Device output channels: stereo
 #define AUDIO_DEVICE_SAMPLE_RATE           0    // Device sample rate (device default)
 
-#define MAX_AUDIO_BUFFER_POOL_CHANNELS    16    // Maximum number of audio pool channels
+#define MAX_AUDIO_BUFFER_POOL_CHANNELS    16    // Maximum number of audio pool channels (voices for PlaySoundVoice())
+#define AUDIO_COMMAND_QUEUE_SIZE         256    // Maximum number of pending mixer commands (power of two)
+#define MAX_AUDIO_STREAM_AUTO_UPDATE       8    // Maximum number of music streams decoded by the background thread
+#define AUDIO_STREAM_UPDATE_INTERVAL       5    // Background music decoding thread wake up interval (milliseconds)
 
 //------------------------------------------------------------------------------------
 // Module: utils - Configuration Flags
@@ -236,9 +251,15 @@
 // NOTE: By default LOG_DEBUG traces not shown
 #define SUPPORT_TRACELOG                1
 //#define SUPPORT_TRACELOG_DEBUG          1
+// Record PROFILE_BEGIN()/PROFILE_END() zones in per-thread ring buffers
+// NOTE: Zones can be read with GetProfileZones() or exported as a Chrome trace with ExportProfileTrace()
+#define SUPPORT_PROFILER                1
 
 // utils: Configuration values
 //------------------------------------------------------------------------------------
 #define MAX_TRACELOG_MSG_LENGTH       256       // Max length of one trace-log message
+#define MAX_PROFILE_ZONES            8192       // Max completed profile zones kept per thread (power of two)
+#define MAX_PROFILE_ZONE_DEPTH         64       // Max nested open profile zones per thread
+#define MAX_PROFILE_THREADS            16       // Max threads recording profile zones at the same time
 
 #endif // CONFIG_H
@@ -181,10 +181,24 @@ typedef struct tagBITMAPINFOHEADER {
 #include <stdio.h>                      // Required for: FILE, fopen(), fclose(), fread()
 #include <string.h>                     // Required for: strcmp() [Used in IsFileExtension(), LoadWaveFromMemory(), LoadMusicStreamFromMemory()]
 
+// Mixing kernels are vectorized when the compiler targets SSE/AVX (i.e. -msse2, -mavx2), scalar loop otherwise
+#if defined(__AVX__)
+    #include <immintrin.h>              // Required for: AVX mixing kernel
+    #define RAUDIO_MIX_AVX
+#endif
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+    #include <xmmintrin.h>              // Required for: SSE mixing kernel
+    #define RAUDIO_MIX_SSE
+#endif
+
 #if defined(RAUDIO_STANDALONE)
     #ifndef TRACELOG
         #define TRACELOG(level, ...)    printf(__VA_ARGS__)
     #endif
+    #ifndef PROFILE_BEGIN
+        #define PROFILE_BEGIN(name)     (void)0
+        #define PROFILE_END()           (void)0
+    #endif
 
     // Allow custom memory allocators
     #ifndef RL_MALLOC
@@ -284,6 +298,15 @@ typedef struct tagBITMAPINFOHEADER {
 #ifndef MAX_AUDIO_BUFFER_POOL_CHANNELS
     #define MAX_AUDIO_BUFFER_POOL_CHANNELS    16    // Audio pool channels
 #endif
+#ifndef AUDIO_COMMAND_QUEUE_SIZE
+    #define AUDIO_COMMAND_QUEUE_SIZE         256    // Pending mixer commands, must be a power of two
+#endif
+#ifndef MAX_AUDIO_STREAM_AUTO_UPDATE
+    #define MAX_AUDIO_STREAM_AUTO_UPDATE       8    // Music streams decoded by the background thread
+#endif
+#ifndef AUDIO_STREAM_UPDATE_INTERVAL
+    #define AUDIO_STREAM_UPDATE_INTERVAL       5    // Background music decoding interval in milliseconds
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
@@ -324,6 +347,25 @@ typedef enum {
     AUDIO_BUFFER_USAGE_STREAM
 } AudioBufferUsage;
 
+// Mixer command type
+// NOTE: Commands are pushed by the game thread and applied by the mixer at the start of every device callback
+typedef enum {
+    AUDIO_COMMAND_PLAY = 0,             // Play buffer from the start
+    AUDIO_COMMAND_PLAY_FROM_CURSOR,     // Play buffer keeping the frame cursor position (music streams)
+    AUDIO_COMMAND_PLAY_VOICE,           // Play pool voice sharing the data of a sound buffer
+    AUDIO_COMMAND_STOP,                 // Stop buffer and rewind it
+    AUDIO_COMMAND_PAUSE,                // Pause buffer
+    AUDIO_COMMAND_RESUME,               // Resume paused buffer
+    AUDIO_COMMAND_VOLUME,               // Set buffer volume
+    AUDIO_COMMAND_PITCH,                // Set buffer pitch (adjusts converter sample rate)
+    AUDIO_COMMAND_PAN,                  // Set buffer pan
+    AUDIO_COMMAND_CALLBACK,             // Set buffer fill callback
+    AUDIO_COMMAND_TRACK,                // Link buffer into the mixing list
+    AUDIO_COMMAND_UNTRACK,              // Unlink buffer from the mixing list
+    AUDIO_COMMAND_ATTACH_PROCESSOR,     // Append processor to buffer (or mixed output if buffer is NULL)
+    AUDIO_COMMAND_DETACH_PROCESSOR      // Remove processors by callback from buffer (or mixed output if buffer is NULL)
+} AudioCommandType;
+
 // Audio buffer struct
 struct rAudioBuffer {
     ma_data_converter converter;    // Audio data converter
@@ -339,6 +381,7 @@ struct rAudioBuffer {
     bool paused;                    // Audio buffer state: AUDIO_PAUSED
     bool looping;                   // Audio buffer looping, default to true for AudioStreams
     int usage;                      // Audio buffer usage mode: STATIC or STREAM
+    int maxVoices;                  // Max pool voices playing this buffer data at once (0: no limit)
 
     bool isSubBufferProcessed[2];   // SubBuffer processed (virtual double buffer)
     unsigned int sizeInFrames;      // Total buffer size in frames
@@ -346,6 +389,7 @@ struct rAudioBuffer {
     unsigned int framesProcessed;   // Total frames processed in this buffer (required for play timing)
 
     unsigned char *data;            // Data buffer, on music stream keeps filling
+    bool isDataBorrowed;            // Data belongs to another buffer (pool voices play sound data in place), not freed on unload
 
     rAudioBuffer *next;             // Next audio buffer on the list
     rAudioBuffer *prev;             // Previous audio buffer on the list
@@ -361,12 +405,33 @@ struct rAudioProcessor {
 
 #define AudioBuffer rAudioBuffer    // HACK: To avoid CoreAudio (macOS) symbol collision
 
+// Audio mixer command
+typedef struct AudioCommand {
+    int type;                       // Command type: AudioCommandType
+    AudioBuffer *buffer;            // Target audio buffer
+    rAudioProcessor *processor;     // Processor to attach
+    AudioCallback callback;         // Buffer callback or processor callback to detach
+    AudioBuffer *source;            // Sound buffer providing the data (pool voices)
+    float value;                    // Volume, pitch or pan value (volume for pool voices)
+    float pitch;                    // Pool voice pitch
+    float pan;                      // Pool voice pan
+} AudioCommand;
+
+// Audio pool voice
+// NOTE: Voice selection happens on the game thread, voice buffer state is owned by the mixer
+typedef struct AudioVoice {
+    AudioBuffer *buffer;            // Voice audio buffer, no data of its own
+    AudioBuffer *source;            // Sound buffer last played on this voice
+    int priority;                   // Priority of the sound played, lower priority voices are stolen first
+    unsigned int sequence;          // Play order, older voices are stolen first
+    ma_uint32 command;              // Queue index of the play command, busy until the mixer applies it
+} AudioVoice;
+
 // Audio data context
 typedef struct AudioData {
     struct {
         ma_context context;         // miniaudio context data
         ma_device device;           // miniaudio device
-        ma_mutex lock;              // miniaudio mutex lock
         bool isReady;               // Check if audio device is ready
         size_t pcmBufferSize;       // Pre-allocated buffer size
         void *pcmBuffer;            // Pre-allocated buffer to read audio data from file/memory
@@ -376,6 +441,25 @@ typedef struct AudioData {
         AudioBuffer *last;          // Pointer to last AudioBuffer in the list
         int defaultSize;            // Default audio buffer size for audio streams
     } Buffer;
+    struct {
+        AudioCommand queue[AUDIO_COMMAND_QUEUE_SIZE]; // Command ring consumed by the mixer only (game thread -> mixer)
+        ma_uint32 writeIndex;       // Commands pushed, written under producerLock
+        ma_uint32 readIndex;        // Commands applied, only written by the mixer
+        ma_spinlock producerLock;   // Serializes producers (game thread and music decoding thread), never taken by the mixer
+        rAudioProcessor *retired;   // Processors detached by the mixer, freed by the game thread
+    } Command;
+    struct {
+        ma_thread thread;           // Music decoding thread, started by the first SetMusicStreamAutoUpdate()
+        ma_mutex lock;              // Music decoders lock, shared by the game thread and the decoding thread only
+        bool isRunning;             // Decoding thread started (only accessed from the game thread)
+        ma_uint32 exit;             // Decoding thread exit request
+        Music music[MAX_AUDIO_STREAM_AUTO_UPDATE]; // Music streams updated by the decoding thread
+        int musicCount;             // Music streams updated by the decoding thread count
+    } Stream;
+    struct {
+        AudioVoice voices[MAX_AUDIO_BUFFER_POOL_CHANNELS]; // Preallocated voices for PlaySoundVoice()
+        unsigned int sequence;      // Voices played counter
+    } Voice;
     rAudioProcessor *mixedProcessor;
 } AudioData;
 
@@ -398,6 +482,20 @@ static AudioData AUDIO = {          // Global AUDIO context
 static void OnLog(void *pUserData, ma_uint32 level, const char *pMessage);
 static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const void *pFramesInput, ma_uint32 frameCount);
 static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, AudioBuffer *buffer);
+static void MixAudioSamples(float *samplesOut, const float *samplesIn, ma_uint32 sampleCount, float gainEven, float gainOdd);
+
+static void PushAudioCommand(AudioCommand command);     // Push command to the mixer queue (game thread)
+static void SyncAudioCommands(void);                    // Wait for the mixer to apply all pushed commands (game thread)
+static void ProcessAudioCommands(void);                 // Apply all pending commands (mixer)
+static void ApplyAudioCommand(const AudioCommand *command); // Apply a single command to mixer-owned state
+
+static bool UpdateMusicStreamBuffers(Music music);      // Refill processed music buffers, returns false if music stopped at its end
+static void RewindMusicStream(Music music);             // Seek music decoder to the start
+static void LockMusicStreams(void);                     // Lock music decoders while the decoding thread is running
+static void UnlockMusicStreams(void);                   // Unlock music decoders
+#if !defined(MA_EMSCRIPTEN)
+static ma_thread_result MA_THREADCALL UpdateMusicStreamsThread(void *data); // Music decoding thread
+#endif
 
 #if defined(RAUDIO_STANDALONE)
 static bool IsFileExtension(const char *fileName, const char *ext); // Check file extension
@@ -475,15 +573,11 @@ void InitAudioDevice(void)
         return;
     }
 
-    // Mixing happens on a separate thread which means we need to synchronize. I'm using a mutex here to make things simple, but may
-    // want to look at something a bit smarter later on to keep everything real-time, if that's necessary.
-    if (ma_mutex_init(&AUDIO.System.lock) != MA_SUCCESS)
-    {
-        TRACELOG(LOG_WARNING, "AUDIO: Failed to create mutex for mixing");
-        ma_device_uninit(&AUDIO.System.device);
-        ma_context_uninit(&AUDIO.System.context);
-        return;
-    }
+    // NOTE: Mixing happens on a separate thread, from now on all AudioBuffer state is owned by the mixer,
+    // game thread changes are pushed to a lock-free command queue and applied at the start of every callback
+    // so neither the audio thread nor the game thread ever block on each other
+    AUDIO.Command.writeIndex = 0;
+    AUDIO.Command.readIndex = 0;
 
     TRACELOG(LOG_INFO, "AUDIO: Device initialized successfully");
     TRACELOG(LOG_INFO, "    > Backend:       miniaudio / %s", ma_get_backend_name(AUDIO.System.context.backend));
@@ -493,6 +587,23 @@ void InitAudioDevice(void)
     TRACELOG(LOG_INFO, "    > Periods size:  %d", AUDIO.System.device.playback.internalPeriodSizeInFrames*AUDIO.System.device.playback.internalPeriods);
 
     AUDIO.System.isReady = true;
+
+    // Preallocate pool voices, they play the data of the sound buffers directly (no copy, no allocation on play)
+    for (int i = 0; i < MAX_AUDIO_BUFFER_POOL_CHANNELS; i++)
+    {
+        AudioBuffer *buffer = LoadAudioBuffer(AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, 0, AUDIO_BUFFER_USAGE_STATIC);
+
+        // NOTE: Voices never own data, release anything allocated for it before PLAY_VOICE points it at a sound
+        if (buffer != NULL)
+        {
+            RL_FREE(buffer->data);
+            buffer->data = NULL;
+            buffer->isDataBorrowed = true;
+        }
+
+        AUDIO.Voice.voices[i] = (AudioVoice){ 0 };
+        AUDIO.Voice.voices[i].buffer = buffer;
+    }
 }
 
 // Close the audio device for all contexts
@@ -500,11 +611,31 @@ void CloseAudioDevice(void)
 {
     if (AUDIO.System.isReady)
     {
-        ma_mutex_uninit(&AUDIO.System.lock);
+        if (AUDIO.Stream.isRunning)
+        {
+            c89atomic_store_explicit_32(&AUDIO.Stream.exit, 1, c89atomic_memory_order_release);
+            ma_thread_wait(&AUDIO.Stream.thread);
+            ma_mutex_uninit(&AUDIO.Stream.lock);
+
+            AUDIO.Stream.isRunning = false;
+            AUDIO.Stream.exit = 0;
+            AUDIO.Stream.musicCount = 0;
+        }
+
         ma_device_uninit(&AUDIO.System.device);
         ma_context_uninit(&AUDIO.System.context);
 
+        // Mixer is stopped, apply any pending commands on this thread
+        ProcessAudioCommands();
         AUDIO.System.isReady = false;
+
+        for (int i = 0; i < MAX_AUDIO_BUFFER_POOL_CHANNELS; i++)
+        {
+            AudioVoice *voice = &AUDIO.Voice.voices[i];
+
+            UnloadAudioBuffer(voice->buffer);
+            *voice = (AudioVoice){ 0 };
+        }
         RL_FREE(AUDIO.System.pcmBuffer);
         AUDIO.System.pcmBuffer = NULL;
         AUDIO.System.pcmBufferSize = 0;
@@ -588,14 +719,26 @@ void UnloadAudioBuffer(AudioBuffer *buffer)
 {
     if (buffer != NULL)
     {
-        ma_data_converter_uninit(&buffer->converter, NULL);
+        // Stop pool voices sharing this buffer data
+        for (int i = 0; i < MAX_AUDIO_BUFFER_POOL_CHANNELS; i++)
+        {
+            if (AUDIO.Voice.voices[i].source == buffer)
+            {
+                StopAudioBuffer(AUDIO.Voice.voices[i].buffer);
+                AUDIO.Voice.voices[i].source = NULL;
+            }
+        }
+
+        // NOTE: Buffer memory can only be released once the mixer has unlinked it
         UntrackAudioBuffer(buffer);
-        RL_FREE(buffer->data);
+        ma_data_converter_uninit(&buffer->converter, NULL);
+        if (!buffer->isDataBorrowed) RL_FREE(buffer->data);
         RL_FREE(buffer);
     }
 }
 
 // Check if an audio buffer is playing
+// NOTE: State is updated by the mixer, commands pushed this frame are not reflected until the next device callback
 bool IsAudioBufferPlaying(AudioBuffer *buffer)
 {
     bool result = false;
@@ -610,63 +753,37 @@ bool IsAudioBufferPlaying(AudioBuffer *buffer)
 // Use PauseAudioBuffer() and ResumeAudioBuffer() if the playback position should be maintained.
 void PlayAudioBuffer(AudioBuffer *buffer)
 {
-    if (buffer != NULL)
-    {
-        buffer->playing = true;
-        buffer->paused = false;
-        buffer->frameCursorPos = 0;
-    }
+    if (buffer != NULL) PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_PLAY, .buffer = buffer });
 }
 
 // Stop an audio buffer
 void StopAudioBuffer(AudioBuffer *buffer)
 {
-    if (buffer != NULL)
-    {
-        if (IsAudioBufferPlaying(buffer))
-        {
-            buffer->playing = false;
-            buffer->paused = false;
-            buffer->frameCursorPos = 0;
-            buffer->framesProcessed = 0;
-            buffer->isSubBufferProcessed[0] = true;
-            buffer->isSubBufferProcessed[1] = true;
-        }
-    }
+    if (buffer != NULL) PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_STOP, .buffer = buffer });
 }
 
 // Pause an audio buffer
 void PauseAudioBuffer(AudioBuffer *buffer)
 {
-    if (buffer != NULL) buffer->paused = true;
+    if (buffer != NULL) PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_PAUSE, .buffer = buffer });
 }
 
 // Resume an audio buffer
 void ResumeAudioBuffer(AudioBuffer *buffer)
 {
-    if (buffer != NULL) buffer->paused = false;
+    if (buffer != NULL) PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_RESUME, .buffer = buffer });
 }
 
 // Set volume for an audio buffer
 void SetAudioBufferVolume(AudioBuffer *buffer, float volume)
 {
-    if (buffer != NULL) buffer->volume = volume;
+    if (buffer != NULL) PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_VOLUME, .buffer = buffer, .value = volume });
 }
 
 // Set pitch for an audio buffer
 void SetAudioBufferPitch(AudioBuffer *buffer, float pitch)
 {
-    if ((buffer != NULL) && (pitch > 0.0f))
-    {
-        // Pitching is just an adjustment of the sample rate.
-        // Note that this changes the duration of the sound:
-        //  - higher pitches will make the sound faster
-        //  - lower pitches make it slower
-        ma_uint32 outputSampleRate = (ma_uint32)((float)buffer->converter.sampleRateOut/pitch);
-        ma_data_converter_set_rate(&buffer->converter, buffer->converter.sampleRateIn, outputSampleRate);
-
-        buffer->pitch = pitch;
-    }
+    if ((buffer != NULL) && (pitch > 0.0f)) PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_PITCH, .buffer = buffer, .value = pitch });
 }
 
 // Set pan for an audio buffer
@@ -675,41 +792,21 @@ void SetAudioBufferPan(AudioBuffer *buffer, float pan)
     if (pan < 0.0f) pan = 0.0f;
     else if (pan > 1.0f) pan = 1.0f;
 
-    if (buffer != NULL) buffer->pan = pan;
+    if (buffer != NULL) PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_PAN, .buffer = buffer, .value = pan });
 }
 
 // Track audio buffer to linked list next position
 void TrackAudioBuffer(AudioBuffer *buffer)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-    {
-        if (AUDIO.Buffer.first == NULL) AUDIO.Buffer.first = buffer;
-        else
-        {
-            AUDIO.Buffer.last->next = buffer;
-            buffer->prev = AUDIO.Buffer.last;
-        }
-
-        AUDIO.Buffer.last = buffer;
-    }
-    ma_mutex_unlock(&AUDIO.System.lock);
+    PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_TRACK, .buffer = buffer });
 }
 
 // Untrack audio buffer from linked list
+// NOTE: Waits for the mixer to unlink the buffer, after returning it is safe to free it
 void UntrackAudioBuffer(AudioBuffer *buffer)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-    {
-        if (buffer->prev == NULL) AUDIO.Buffer.first = buffer->next;
-        else buffer->prev->next = buffer->next;
-
-        if (buffer->next == NULL) AUDIO.Buffer.last = buffer->prev;
-        else buffer->next->prev = buffer->prev;
-
-        buffer->prev = NULL;
-        buffer->next = NULL;
-    }
-    ma_mutex_unlock(&AUDIO.System.lock);
+    PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_UNTRACK, .buffer = buffer });
+    SyncAudioCommands();
 }
 
 //----------------------------------------------------------------------------------
@@ -1116,6 +1213,88 @@ void SetSoundPan(Sound sound, float pan)
     SetAudioBufferPan(sound.stream.buffer, pan);
 }
 
+// Play a sound on a pool voice, allowing several instances of the same sound to overlap
+// NOTE: Voice is chosen in this order: oldest instance of the sound if its voices limit is reached,
+// a free voice, the oldest voice playing the lowest priority not above the requested one. Otherwise the sound is dropped
+int PlaySoundVoice(Sound sound, float volume, float pitch, float pan, int priority)
+{
+    AudioBuffer *source = sound.stream.buffer;
+
+    if (!AUDIO.System.isReady || (source == NULL) || (source->usage != AUDIO_BUFFER_USAGE_STATIC) || (pitch <= 0.0f)) return -1;
+
+    ma_uint32 commandsApplied = c89atomic_load_explicit_32(&AUDIO.Command.readIndex, c89atomic_memory_order_acquire);
+
+    int freeVoice = -1;
+    int oldestInstance = -1;
+    int stolenVoice = -1;
+    int instances = 0;
+
+    for (int i = 0; i < MAX_AUDIO_BUFFER_POOL_CHANNELS; i++)
+    {
+        AudioVoice *voice = &AUDIO.Voice.voices[i];
+
+        // NOTE: A voice is busy until its play command has been applied, even if the mixer still reports it stopped
+        bool busy = (voice->source != NULL) && (voice->buffer->playing || ((int)(voice->command - commandsApplied) >= 0));
+
+        if (!busy)
+        {
+            if (freeVoice == -1) freeVoice = i;
+            continue;
+        }
+
+        if (voice->source == source)
+        {
+            instances++;
+            if ((oldestInstance == -1) || (voice->sequence < AUDIO.Voice.voices[oldestInstance].sequence)) oldestInstance = i;
+        }
+
+        if (voice->priority <= priority)
+        {
+            if ((stolenVoice == -1) || (voice->priority < AUDIO.Voice.voices[stolenVoice].priority) ||
+                ((voice->priority == AUDIO.Voice.voices[stolenVoice].priority) && (voice->sequence < AUDIO.Voice.voices[stolenVoice].sequence))) stolenVoice = i;
+        }
+    }
+
+    int index = -1;
+
+    if ((source->maxVoices > 0) && (instances >= source->maxVoices)) index = oldestInstance;
+    else if (freeVoice != -1) index = freeVoice;
+    else index = stolenVoice;
+
+    if (index == -1) return -1;
+
+    if (pan < 0.0f) pan = 0.0f;
+    else if (pan > 1.0f) pan = 1.0f;
+
+    AudioVoice *voice = &AUDIO.Voice.voices[index];
+    voice->source = source;
+    voice->priority = priority;
+    voice->sequence = ++AUDIO.Voice.sequence;
+
+    PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_PLAY_VOICE, .buffer = voice->buffer, .source = source, .value = volume, .pitch = pitch, .pan = pan });
+    voice->command = c89atomic_load_explicit_32(&AUDIO.Command.writeIndex, c89atomic_memory_order_relaxed) - 1;
+
+    // Voice id includes the play order so a stale id does not stop a voice that has been reused since
+    return (int)((voice->sequence & 0xfffff)*MAX_AUDIO_BUFFER_POOL_CHANNELS + index);
+}
+
+// Stop a pool voice started with PlaySoundVoice()
+void StopSoundVoice(int voice)
+{
+    if ((voice < 0) || !AUDIO.System.isReady) return;
+
+    AudioVoice *poolVoice = &AUDIO.Voice.voices[voice%MAX_AUDIO_BUFFER_POOL_CHANNELS];
+
+    if ((poolVoice->source != NULL) && ((poolVoice->sequence & 0xfffff) == (unsigned int)(voice/MAX_AUDIO_BUFFER_POOL_CHANNELS))) StopAudioBuffer(poolVoice->buffer);
+}
+
+// Set max pool voices playing a sound at once (0: no limit)
+// NOTE: Only read by PlaySoundVoice() on the calling thread, no mixer command required
+void SetSoundMaxVoices(Sound sound, int maxVoices)
+{
+    if (sound.stream.buffer != NULL) sound.stream.buffer->maxVoices = maxVoices;
+}
+
 // Convert wave data to desired format
 void WaveFormat(Wave *wave, int sampleRate, int sampleSize, int channels)
 {
@@ -1630,6 +1809,7 @@ bool IsMusicReady(Music music)
 // Unload music stream
 void UnloadMusicStream(Music music)
 {
+    SetMusicStreamAutoUpdate(music, false);     // Decoder must not be in use by the decoding thread
     UnloadAudioStream(music.stream);
 
     if (music.ctxData != NULL)
@@ -1668,9 +1848,7 @@ void PlayMusicStream(Music music)
         // This is a hack for this section of code in UpdateMusicStream()
         // NOTE: In case window is minimized, music stream is stopped, just make sure to
         // play again on window restore: if (IsMusicStreamPlaying(music)) PlayMusicStream(music);
-        ma_uint32 frameCursorPos = music.stream.buffer->frameCursorPos;
-        PlayAudioStream(music.stream);  // WARNING: This resets the cursor position.
-        music.stream.buffer->frameCursorPos = frameCursorPos;
+        PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_PLAY_FROM_CURSOR, .buffer = music.stream.buffer });
     }
 }
 
@@ -1689,33 +1867,10 @@ void ResumeMusicStream(Music music)
 // Stop music playing (close stream)
 void StopMusicStream(Music music)
 {
+    LockMusicStreams();
     StopAudioStream(music.stream);
-
-    switch (music.ctxType)
-    {
-#if defined(SUPPORT_FILEFORMAT_WAV)
-        case MUSIC_AUDIO_WAV: drwav_seek_to_first_pcm_frame((drwav *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_OGG)
-        case MUSIC_AUDIO_OGG: stb_vorbis_seek_start((stb_vorbis *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_MP3)
-        case MUSIC_AUDIO_MP3: drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_QOA)
-        case MUSIC_AUDIO_QOA: qoaplay_rewind((qoaplay_desc *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_FLAC)
-        case MUSIC_AUDIO_FLAC: drflac__seek_to_first_frame((drflac *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_XM)
-        case MUSIC_MODULE_XM: jar_xm_reset((jar_xm_context_t *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_MOD)
-        case MUSIC_MODULE_MOD: jar_mod_seek_start((jar_mod_context_t *)music.ctxData); break;
-#endif
-        default: break;
-    }
+    RewindMusicStream(music);
+    UnlockMusicStreams();
 }
 
 // Seek music to a certain position (in seconds)
@@ -1726,6 +1881,8 @@ void SeekMusicStream(Music music, float position)
 
     unsigned int positionInFrames = (unsigned int)(position*music.stream.sampleRate);
 
+    LockMusicStreams();
+
     switch (music.ctxType)
     {
 #if defined(SUPPORT_FILEFORMAT_WAV)
@@ -1747,6 +1904,8 @@ void SeekMusicStream(Music music, float position)
     }
 
     music.stream.buffer->framesProcessed = positionInFrames;
+
+    UnlockMusicStreams();
 }
 
 // Update (re-fill) music buffers if data already processed
@@ -1754,6 +1913,100 @@ void UpdateMusicStream(Music music)
 {
     if (music.stream.buffer == NULL) return;
 
+    LockMusicStreams();
+    bool playing = UpdateMusicStreamBuffers(music);
+    UnlockMusicStreams();
+
+    // NOTE: In case window is minimized, music stream is stopped,
+    // just make sure to play again on window restore
+    if (playing && IsMusicStreamPlaying(music)) PlayMusicStream(music);
+}
+
+// Set music buffers to be updated on a background decoding thread
+// NOTE: Music is copied, set music.looping before enabling it. UnloadMusicStream() disables it
+void SetMusicStreamAutoUpdate(Music music, bool autoUpdate)
+{
+    if (music.stream.buffer == NULL) return;
+
+#if defined(MA_EMSCRIPTEN)
+    if (autoUpdate) TRACELOG(LOG_WARNING, "STREAM: Background music decoding not supported, UpdateMusicStream() required");
+#else
+    if (autoUpdate && !AUDIO.Stream.isRunning)
+    {
+        if (!AUDIO.System.isReady) return;
+
+        if (ma_mutex_init(&AUDIO.Stream.lock) != MA_SUCCESS)
+        {
+            TRACELOG(LOG_WARNING, "STREAM: Failed to create music decoding lock");
+            return;
+        }
+
+        if (ma_thread_create(&AUDIO.Stream.thread, ma_thread_priority_default, 0, UpdateMusicStreamsThread, NULL, NULL) != MA_SUCCESS)
+        {
+            TRACELOG(LOG_WARNING, "STREAM: Failed to create music decoding thread");
+            ma_mutex_uninit(&AUDIO.Stream.lock);
+            return;
+        }
+
+        AUDIO.Stream.isRunning = true;
+        TRACELOG(LOG_INFO, "STREAM: Music decoding thread started");
+    }
+
+    LockMusicStreams();
+
+    int index = -1;
+    for (int i = 0; i < AUDIO.Stream.musicCount; i++)
+    {
+        if (AUDIO.Stream.music[i].stream.buffer == music.stream.buffer) index = i;
+    }
+
+    if (autoUpdate)
+    {
+        if (index != -1) AUDIO.Stream.music[index] = music;
+        else if (AUDIO.Stream.musicCount < MAX_AUDIO_STREAM_AUTO_UPDATE) AUDIO.Stream.music[AUDIO.Stream.musicCount++] = music;
+        else TRACELOG(LOG_WARNING, "STREAM: Too many music streams decoded in background (MAX_AUDIO_STREAM_AUTO_UPDATE)");
+    }
+    else if (index != -1) AUDIO.Stream.music[index] = AUDIO.Stream.music[--AUDIO.Stream.musicCount];
+
+    UnlockMusicStreams();
+#endif
+}
+
+// Seek music decoder to the start
+static void RewindMusicStream(Music music)
+{
+    switch (music.ctxType)
+    {
+#if defined(SUPPORT_FILEFORMAT_WAV)
+        case MUSIC_AUDIO_WAV: drwav_seek_to_first_pcm_frame((drwav *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_OGG)
+        case MUSIC_AUDIO_OGG: stb_vorbis_seek_start((stb_vorbis *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_MP3)
+        case MUSIC_AUDIO_MP3: drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_QOA)
+        case MUSIC_AUDIO_QOA: qoaplay_rewind((qoaplay_desc *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_FLAC)
+        case MUSIC_AUDIO_FLAC: drflac__seek_to_first_frame((drflac *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_XM)
+        case MUSIC_MODULE_XM: jar_xm_reset((jar_xm_context_t *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_MOD)
+        case MUSIC_MODULE_MOD: jar_mod_seek_start((jar_mod_context_t *)music.ctxData); break;
+#endif
+        default: break;
+    }
+}
+
+// Refill processed music buffers, returns false if music stopped at its end
+// NOTE: Called from the game thread or the music decoding thread with music decoders locked
+static bool UpdateMusicStreamBuffers(Music music)
+{
+
     unsigned int subBufferSizeInFrames = music.stream.buffer->sizeInFrames/2;
 
     // On first call of this function we lazily pre-allocated a temp buffer to read audio files/memory data in
@@ -1898,15 +2151,14 @@ void UpdateMusicStream(Music music)
             if (!music.looping)
             {
                 // Streaming is ending, we filled latest frames from input
-                StopMusicStream(music);
-                return;
+                StopAudioStream(music.stream);
+                RewindMusicStream(music);
+                return false;
             }
         }
     }
 
-    // NOTE: In case window is minimized, music stream is stopped,
-    // just make sure to play again on window restore
-    if (IsMusicStreamPlaying(music)) PlayMusicStream(music);
+    return true;
 }
 
 // Check if any music is playing
@@ -2141,60 +2393,29 @@ void SetAudioStreamBufferSizeDefault(int size)
 // Audio thread callback to request new data
 void SetAudioStreamCallback(AudioStream stream, AudioCallback callback)
 {
-    if (stream.buffer != NULL) stream.buffer->callback = callback;
+    if (stream.buffer != NULL) PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_CALLBACK, .buffer = stream.buffer, .callback = callback });
 }
 
 // Add processor to audio stream. Contrary to buffers, the order of processors is important.
 // The new processor must be added at the end. As there aren't supposed to be a lot of processors attached to
-// a given stream, we iterate through the list to find the end. That way we don't need a pointer to the last element.
+// a given stream, the mixer iterates through the list to find the end. That way we don't need a pointer to the last element.
 void AttachAudioStreamProcessor(AudioStream stream, AudioCallback process)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
+    if (stream.buffer == NULL) return;
 
     rAudioProcessor *processor = (rAudioProcessor *)RL_CALLOC(1, sizeof(rAudioProcessor));
     processor->process = process;
 
-    rAudioProcessor *last = stream.buffer->processor;
-
-    while (last && last->next)
-    {
-        last = last->next;
-    }
-    if (last)
-    {
-        processor->prev = last;
-        last->next = processor;
-    }
-    else stream.buffer->processor = processor;
-
-    ma_mutex_unlock(&AUDIO.System.lock);
+    PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_ATTACH_PROCESSOR, .buffer = stream.buffer, .processor = processor });
 }
 
 // Remove processor from audio stream
 void DetachAudioStreamProcessor(AudioStream stream, AudioCallback process)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-
-    rAudioProcessor *processor = stream.buffer->processor;
-
-    while (processor)
-    {
-        rAudioProcessor *next = processor->next;
-        rAudioProcessor *prev = processor->prev;
+    if (stream.buffer == NULL) return;
 
-        if (processor->process == process)
-        {
-            if (stream.buffer->processor == processor) stream.buffer->processor = next;
-            if (prev) prev->next = next;
-            if (next) next->prev = prev;
-
-            RL_FREE(processor);
-        }
-
-        processor = next;
-    }
-
-    ma_mutex_unlock(&AUDIO.System.lock);
+    PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_DETACH_PROCESSOR, .buffer = stream.buffer, .callback = process });
+    SyncAudioCommands();
 }
 
 // Add processor to audio pipeline. Order of processors is important
@@ -2202,52 +2423,17 @@ void DetachAudioStreamProcessor(AudioStream stream, AudioCallback process)
 // these two work on the already mixed output just before sending it to the sound hardware
 void AttachAudioMixedProcessor(AudioCallback process)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-
     rAudioProcessor *processor = (rAudioProcessor *)RL_CALLOC(1, sizeof(rAudioProcessor));
     processor->process = process;
 
-    rAudioProcessor *last = AUDIO.mixedProcessor;
-
-    while (last && last->next)
-    {
-        last = last->next;
-    }
-    if (last)
-    {
-        processor->prev = last;
-        last->next = processor;
-    }
-    else AUDIO.mixedProcessor = processor;
-
-    ma_mutex_unlock(&AUDIO.System.lock);
+    PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_ATTACH_PROCESSOR, .buffer = NULL, .processor = processor });
 }
 
 // Remove processor from audio pipeline
 void DetachAudioMixedProcessor(AudioCallback process)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-
-    rAudioProcessor *processor = AUDIO.mixedProcessor;
-
-    while (processor)
-    {
-        rAudioProcessor *next = processor->next;
-        rAudioProcessor *prev = processor->prev;
-
-        if (processor->process == process)
-        {
-            if (AUDIO.mixedProcessor == processor) AUDIO.mixedProcessor = next;
-            if (prev) prev->next = next;
-            if (next) next->prev = prev;
-
-            RL_FREE(processor);
-        }
-
-        processor = next;
-    }
-
-    ma_mutex_unlock(&AUDIO.System.lock);
+    PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_DETACH_PROCESSOR, .buffer = NULL, .callback = process });
+    SyncAudioCommands();
 }
 
 
@@ -2333,9 +2519,10 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
             currentSubBufferIndex = (currentSubBufferIndex + 1)%2;
 
             // We need to break from this loop if we're not looping
+            // NOTE: Running on the mixer, state is changed in place instead of pushing a command
             if (!audioBuffer->looping)
             {
-                StopAudioBuffer(audioBuffer);
+                ApplyAudioCommand(&(AudioCommand){ .type = AUDIO_COMMAND_STOP, .buffer = audioBuffer });
                 break;
             }
         }
@@ -2363,7 +2550,16 @@ static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, f
     // should be defined by the output format of the data converter. We do this until frameCount frames have been output. The important
     // detail to remember here is that we never, ever attempt to read more input data than is required for the specified number of output
     // frames. This can be achieved with ma_data_converter_get_required_input_frame_count().
-    ma_uint8 inputBuffer[4096] = { 0 };
+    // Buffer data already in mixing format at the device sample rate does not need conversion
+    // NOTE: Pitch is applied by the converter resampler, its rates are not reflected in the converter sample rates
+    if ((audioBuffer->pitch == 1.0f) && (audioBuffer->converter.formatIn == ma_format_f32) &&
+        (audioBuffer->converter.channelsIn == audioBuffer->converter.channelsOut) &&
+        (audioBuffer->converter.sampleRateIn == audioBuffer->converter.sampleRateOut))
+    {
+        return ReadAudioBufferFramesInInternalFormat(audioBuffer, framesOut, frameCount);
+    }
+
+    ma_uint8 inputBuffer[4096];         // Only the frames read are converted so no clearing required
     ma_uint32 inputBufferFrameCap = sizeof(inputBuffer)/ma_get_bytes_per_frame(audioBuffer->converter.formatIn, audioBuffer->converter.channelsIn);
 
     ma_uint32 totalOutputFramesProcessed = 0;
@@ -2409,12 +2605,15 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
 {
     (void)pDevice;
 
+    // NOTE: Called from the audio device thread, zones are recorded in that thread's profiler ring
+    PROFILE_BEGIN("OnSendAudioDataToDevice");
+
     // Mixing is basically just an accumulation, we need to initialize the output buffer to 0
     memset(pFramesOut, 0, frameCount*pDevice->playback.channels*ma_get_bytes_per_sample(pDevice->playback.format));
 
-    // Using a mutex here for thread-safety which makes things not real-time
-    // This is unlikely to be necessary for this project, but may want to consider how you might want to avoid this
-    ma_mutex_lock(&AUDIO.System.lock);
+    // Apply game thread changes before mixing, the mixer owns all buffer state so no lock is required
+    ProcessAudioCommands();
+
     {
         for (AudioBuffer *audioBuffer = AUDIO.Buffer.first; audioBuffer != NULL; audioBuffer = audioBuffer->next)
         {
@@ -2432,7 +2631,7 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
 
                 while (framesToRead > 0)
                 {
-                    float tempBuffer[1024] = { 0 }; // Frames for stereo
+                    float tempBuffer[1024];         // Frames for stereo, only the frames read are mixed so no clearing required
 
                     ma_uint32 framesToReadRightNow = framesToRead;
                     if (framesToReadRightNow > sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS)
@@ -2471,7 +2670,7 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
                     {
                         if (!audioBuffer->looping)
                         {
-                            StopAudioBuffer(audioBuffer);
+                            ApplyAudioCommand(&(AudioCommand){ .type = AUDIO_COMMAND_STOP, .buffer = audioBuffer });
                             break;
                         }
                         else
@@ -2498,7 +2697,235 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
         processor = processor->next;
     }
 
-    ma_mutex_unlock(&AUDIO.System.lock);
+    PROFILE_END();
+}
+
+// Lock music decoders while the decoding thread is running
+// NOTE: Only the game thread and the decoding thread take this lock, the mixer never does
+static void LockMusicStreams(void)
+{
+    if (AUDIO.Stream.isRunning) ma_mutex_lock(&AUDIO.Stream.lock);
+}
+
+// Unlock music decoders
+static void UnlockMusicStreams(void)
+{
+    if (AUDIO.Stream.isRunning) ma_mutex_unlock(&AUDIO.Stream.lock);
+}
+
+#if !defined(MA_EMSCRIPTEN)
+// Music decoding thread, keeps the double buffer of every auto-updated music stream filled
+static ma_thread_result MA_THREADCALL UpdateMusicStreamsThread(void *data)
+{
+    (void)data;
+
+    while (!c89atomic_load_explicit_32(&AUDIO.Stream.exit, c89atomic_memory_order_acquire))
+    {
+        PROFILE_BEGIN("UpdateMusicStreams");
+
+        ma_mutex_lock(&AUDIO.Stream.lock);
+        for (int i = 0; i < AUDIO.Stream.musicCount; i++)
+        {
+            if (IsMusicStreamPlaying(AUDIO.Stream.music[i])) UpdateMusicStreamBuffers(AUDIO.Stream.music[i]);
+        }
+        ma_mutex_unlock(&AUDIO.Stream.lock);
+
+        PROFILE_END();
+
+        ma_sleep(AUDIO_STREAM_UPDATE_INTERVAL);
+    }
+
+    return (ma_thread_result)0;
+}
+#endif
+
+// Push command to the mixer queue
+// NOTE: Called from the game thread (and music decoding thread), it never waits on the mixer unless the queue is full
+static void PushAudioCommand(AudioCommand command)
+{
+#if defined(MA_EMSCRIPTEN)
+    // Web Audio mixes on the main thread, commands can be applied in place
+    ApplyAudioCommand(&command);
+#else
+    // No mixer running, state can be modified directly
+    if (!AUDIO.System.isReady)
+    {
+        ApplyAudioCommand(&command);
+        return;
+    }
+
+    // NOTE: Music decoding thread also stops finished streams, producers take turns on a spinlock held for a few stores
+    ma_spinlock_lock(&AUDIO.Command.producerLock);
+
+    ma_uint32 writeIndex = c89atomic_load_explicit_32(&AUDIO.Command.writeIndex, c89atomic_memory_order_relaxed);
+
+    // NOTE: Queue full means the mixer is AUDIO_COMMAND_QUEUE_SIZE commands behind, wait for next callback
+    while ((writeIndex - c89atomic_load_explicit_32(&AUDIO.Command.readIndex, c89atomic_memory_order_acquire)) >= AUDIO_COMMAND_QUEUE_SIZE) ma_sleep(1);
+
+    AUDIO.Command.queue[writeIndex & (AUDIO_COMMAND_QUEUE_SIZE - 1)] = command;
+    c89atomic_store_explicit_32(&AUDIO.Command.writeIndex, writeIndex + 1, c89atomic_memory_order_release);
+
+    ma_spinlock_unlock(&AUDIO.Command.producerLock);
+#endif
+}
+
+// Wait for the mixer to apply all pushed commands
+// NOTE: Only required before releasing memory referenced by the mixer (buffers, processors)
+static void SyncAudioCommands(void)
+{
+#if !defined(MA_EMSCRIPTEN)
+    if (AUDIO.System.isReady)
+    {
+        ma_uint32 writeIndex = c89atomic_load_explicit_32(&AUDIO.Command.writeIndex, c89atomic_memory_order_relaxed);
+
+        while (c89atomic_load_explicit_32(&AUDIO.Command.readIndex, c89atomic_memory_order_acquire) != writeIndex) ma_sleep(1);
+    }
+#endif
+
+    // Mixer has unlinked detached processors, they can be released now
+    while (AUDIO.Command.retired != NULL)
+    {
+        rAudioProcessor *next = AUDIO.Command.retired->next;
+        RL_FREE(AUDIO.Command.retired);
+        AUDIO.Command.retired = next;
+    }
+}
+
+// Apply all pending commands
+// NOTE: Called from the audio device thread (single consumer) at the start of every callback
+static void ProcessAudioCommands(void)
+{
+    ma_uint32 readIndex = c89atomic_load_explicit_32(&AUDIO.Command.readIndex, c89atomic_memory_order_relaxed);
+    ma_uint32 writeIndex = c89atomic_load_explicit_32(&AUDIO.Command.writeIndex, c89atomic_memory_order_acquire);
+
+    for (; readIndex != writeIndex; readIndex++) ApplyAudioCommand(&AUDIO.Command.queue[readIndex & (AUDIO_COMMAND_QUEUE_SIZE - 1)]);
+
+    c89atomic_store_explicit_32(&AUDIO.Command.readIndex, readIndex, c89atomic_memory_order_release);
+}
+
+// Apply a single command to mixer-owned state
+static void ApplyAudioCommand(const AudioCommand *command)
+{
+    AudioBuffer *buffer = command->buffer;
+
+    switch (command->type)
+    {
+        case AUDIO_COMMAND_PLAY:
+        {
+            buffer->playing = true;
+            buffer->paused = false;
+            buffer->frameCursorPos = 0;
+        } break;
+        case AUDIO_COMMAND_PLAY_FROM_CURSOR:
+        {
+            buffer->playing = true;
+            buffer->paused = false;
+        } break;
+        case AUDIO_COMMAND_PLAY_VOICE:
+        {
+            // Voice reads the sound data in place, sounds are always stored in device format
+            buffer->data = command->source->data;
+            buffer->sizeInFrames = command->source->sizeInFrames;
+            buffer->volume = command->value;
+            buffer->pan = command->pan;
+            if (buffer->pitch != command->pitch) ApplyAudioCommand(&(AudioCommand){ .type = AUDIO_COMMAND_PITCH, .buffer = buffer, .value = command->pitch });
+
+            buffer->playing = true;
+            buffer->paused = false;
+            buffer->frameCursorPos = 0;
+            buffer->framesProcessed = 0;
+        } break;
+        case AUDIO_COMMAND_STOP:
+        {
+            if (buffer->playing && !buffer->paused)
+            {
+                buffer->playing = false;
+                buffer->paused = false;
+                buffer->frameCursorPos = 0;
+                buffer->framesProcessed = 0;
+                buffer->isSubBufferProcessed[0] = true;
+                buffer->isSubBufferProcessed[1] = true;
+            }
+        } break;
+        case AUDIO_COMMAND_PAUSE: buffer->paused = true; break;
+        case AUDIO_COMMAND_RESUME: buffer->paused = false; break;
+        case AUDIO_COMMAND_VOLUME: buffer->volume = command->value; break;
+        case AUDIO_COMMAND_PITCH:
+        {
+            // Pitching is just an adjustment of the sample rate.
+            // Note that this changes the duration of the sound:
+            //  - higher pitches will make the sound faster
+            //  - lower pitches make it slower
+            ma_uint32 outputSampleRate = (ma_uint32)((float)buffer->converter.sampleRateOut/command->value);
+            ma_data_converter_set_rate(&buffer->converter, buffer->converter.sampleRateIn, outputSampleRate);
+
+            buffer->pitch = command->value;
+        } break;
+        case AUDIO_COMMAND_PAN: buffer->pan = command->value; break;
+        case AUDIO_COMMAND_CALLBACK: buffer->callback = command->callback; break;
+        case AUDIO_COMMAND_TRACK:
+        {
+            if (AUDIO.Buffer.first == NULL) AUDIO.Buffer.first = buffer;
+            else
+            {
+                AUDIO.Buffer.last->next = buffer;
+                buffer->prev = AUDIO.Buffer.last;
+            }
+
+            AUDIO.Buffer.last = buffer;
+        } break;
+        case AUDIO_COMMAND_UNTRACK:
+        {
+            if (buffer->prev == NULL) AUDIO.Buffer.first = buffer->next;
+            else buffer->prev->next = buffer->next;
+
+            if (buffer->next == NULL) AUDIO.Buffer.last = buffer->prev;
+            else buffer->next->prev = buffer->prev;
+
+            buffer->prev = NULL;
+            buffer->next = NULL;
+        } break;
+        case AUDIO_COMMAND_ATTACH_PROCESSOR:
+        {
+            rAudioProcessor **first = (buffer != NULL)? &buffer->processor : &AUDIO.mixedProcessor;
+            rAudioProcessor *last = *first;
+
+            while (last && last->next) last = last->next;
+
+            if (last)
+            {
+                command->processor->prev = last;
+                last->next = command->processor;
+            }
+            else *first = command->processor;
+        } break;
+        case AUDIO_COMMAND_DETACH_PROCESSOR:
+        {
+            rAudioProcessor **first = (buffer != NULL)? &buffer->processor : &AUDIO.mixedProcessor;
+            rAudioProcessor *processor = *first;
+
+            while (processor)
+            {
+                rAudioProcessor *next = processor->next;
+                rAudioProcessor *prev = processor->prev;
+
+                if (processor->process == command->callback)
+                {
+                    if (*first == processor) *first = next;
+                    if (prev) prev->next = next;
+                    if (next) next->prev = prev;
+
+                    // Released by the game thread once the command has been applied
+                    processor->next = AUDIO.Command.retired;
+                    processor->prev = NULL;
+                    AUDIO.Command.retired = processor;
+                }
+
+                processor = next;
+            }
+        } break;
+        default: break;
+    }
 }
 
 // Main mixing function, pretty simple in this project, just an accumulation
@@ -2516,32 +2943,41 @@ static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 fr
         // Fast sine approximation in [0..1] for pan law: y = 0.5f*x*(3 - x*x);
         const float levels[2] = { localVolume*0.5f*left*(3.0f - left*left), localVolume*0.5f*right*(3.0f - right*right) };
 
-        float *frameOut = framesOut;
-        const float *frameIn = framesIn;
+        MixAudioSamples(framesOut, framesIn, frameCount*2, levels[0], levels[1]);
+    }
+    else MixAudioSamples(framesOut, framesIn, frameCount*channels, localVolume, localVolume); // We do not consider panning
+}
 
-        for (ma_uint32 frame = 0; frame < frameCount; frame++)
-        {
-            frameOut[0] += (frameIn[0]*levels[0]);
-            frameOut[1] += (frameIn[1]*levels[1]);
+// Accumulate input samples multiplied by gain into output, even and odd samples use their own gain (stereo left/right)
+// NOTE: Vector widths are even so every lane keeps its channel, all paths multiply then add (no fused multiply-add)
+static void MixAudioSamples(float *samplesOut, const float *samplesIn, ma_uint32 sampleCount, float gainEven, float gainOdd)
+{
+    ma_uint32 i = 0;
 
-            frameOut += 2;
-            frameIn += 2;
-        }
+#if defined(RAUDIO_MIX_AVX)
+    const __m256 gains8 = _mm256_setr_ps(gainEven, gainOdd, gainEven, gainOdd, gainEven, gainOdd, gainEven, gainOdd);
+
+    for (; (i + 8) <= sampleCount; i += 8)
+    {
+        _mm256_storeu_ps(samplesOut + i, _mm256_add_ps(_mm256_loadu_ps(samplesOut + i), _mm256_mul_ps(_mm256_loadu_ps(samplesIn + i), gains8)));
     }
-    else  // We do not consider panning
+#endif
+#if defined(RAUDIO_MIX_SSE)
+    const __m128 gains4 = _mm_setr_ps(gainEven, gainOdd, gainEven, gainOdd);
+
+    for (; (i + 4) <= sampleCount; i += 4)
     {
-        for (ma_uint32 frame = 0; frame < frameCount; frame++)
-        {
-            for (ma_uint32 c = 0; c < channels; c++)
-            {
-                float *frameOut = framesOut + (frame*channels);
-                const float *frameIn = framesIn + (frame*channels);
+        _mm_storeu_ps(samplesOut + i, _mm_add_ps(_mm_loadu_ps(samplesOut + i), _mm_mul_ps(_mm_loadu_ps(samplesIn + i), gains4)));
+    }
+#endif
 
-                // Output accumulates input multiplied by volume to provided output (usually 0)
-                frameOut[c] += (frameIn[c]*localVolume);
-            }
-        }
+    for (; (i + 2) <= sampleCount; i += 2)
+    {
+        samplesOut[i] += (samplesIn[i]*gainEven);
+        samplesOut[i + 1] += (samplesIn[i + 1]*gainOdd);
     }
+
+    if (i < sampleCount) samplesOut[i] += (samplesIn[i]*gainEven);
 }
 
 // Some required functions for audio standalone module version
@@ -284,6 +284,24 @@ typedef struct NPatchInfo {
     int layout;             // Layout of the n-patch: 3x3, 1x3 or 3x1
 } NPatchInfo;
 
+// SpriteInstance, texture region drawn by DrawSprites()
+typedef struct SpriteInstance {
+    Texture2D texture;      // Sprite texture
+    Rectangle source;       // Texture source rectangle (negative width/height flip the sprite)
+    Rectangle dest;         // Destination rectangle
+    Vector2 origin;         // Rotation origin, relative to destination rectangle
+    float rotation;         // Rotation in degrees
+    Color tint;             // Tint color
+} SpriteInstance;
+
+// TextureAtlas, images packed into a single texture
+typedef struct TextureAtlas {
+    Texture2D texture;      // Atlas texture (built by BuildTextureAtlas())
+    int imageCount;         // Number of registered images
+    Image *images;          // Registered images (R8G8B8A8 copies)
+    Rectangle *recs;        // Registered images rectangles in atlas texture
+} TextureAtlas;
+
 // GlyphInfo, font characters glyphs info
 typedef struct GlyphInfo {
     int value;              // Character value (Unicode)
@@ -497,6 +515,28 @@ typedef struct FilePathList {
     char **paths;                   // Filepaths entries
 } FilePathList;
 
+// RandomGenerator, pseudo-random number generator state (xoshiro128**)
+// NOTE: Functions using a generator are not thread-safe on the same generator, use one per thread
+typedef struct RandomGenerator {
+    unsigned int state[4];          // Generator state (never all zero, set it with SetRandomGeneratorSeed())
+} RandomGenerator;
+
+// ProfileZone, one completed profiling zone
+typedef struct ProfileZone {
+    const char *name;               // Zone name (as passed to BeginProfileZone(), not copied)
+    unsigned long long start;       // Zone start time in nanoseconds (GetProfileTime())
+    unsigned long long end;         // Zone end time in nanoseconds (GetProfileTime())
+    unsigned int thread;            // Profiler thread id of the recording thread
+    unsigned int depth;             // Number of zones open on the thread when this one began
+} ProfileZone;
+
+// DrawCullStats, 2D draw culling counters
+// NOTE: Counters are reset on BeginDrawing(), primitives recorded into command buffers are not counted
+typedef struct DrawCullStats {
+    unsigned int culled;            // Primitives skipped, outside the visible area
+    unsigned int emitted;           // Primitives added to the render batch
+} DrawCullStats;
+
 //----------------------------------------------------------------------------------
 // Enumerators Definition
 //----------------------------------------------------------------------------------
@@ -518,7 +558,8 @@ typedef enum {
     FLAG_WINDOW_HIGHDPI     = 0x00002000,   // Set to support HighDPI
     FLAG_WINDOW_MOUSE_PASSTHROUGH = 0x00004000, // Set to support mouse passthrough, only supported when FLAG_WINDOW_UNDECORATED
     FLAG_MSAA_4X_HINT       = 0x00000020,   // Set to try enabling MSAA 4X
-    FLAG_INTERLACED_HINT    = 0x00010000    // Set to try enabling interlaced video format (for V3D)
+    FLAG_INTERLACED_HINT    = 0x00010000,   // Set to try enabling interlaced video format (for V3D)
+    FLAG_BATCH_STREAM_HINT  = 0x00020000    // Set to stream the default render batch as interleaved vertices through persistently mapped buffers
 } ConfigFlags;
 
 // Trace log level
@@ -902,6 +943,12 @@ typedef enum {
     NPATCH_THREE_PATCH_HORIZONTAL   // Npatch layout: 3x1 tiles
 } NPatchLayout;
 
+// Shapes drawing mode
+typedef enum {
+    SHAPES_MODE_TESSELLATED = 0,    // Circles, rings and rounded rectangles tessellated into triangles (default)
+    SHAPES_MODE_SDF                 // Circles, rings and rounded rectangles drawn as quads shaded by signed distance
+} ShapesMode;
+
 // Callbacks to hook some internal functions
 // WARNING: These callbacks are intended for advance users
 typedef void (*TraceLogCallback)(int logLevel, const char *text, va_list args);  // Logging: Redirect trace log messages
@@ -1002,6 +1049,8 @@ RLAPI void BeginBlendMode(int mode);                              // Begin blend
 RLAPI void EndBlendMode(void);                                    // End blending mode (reset to default: alpha blending)
 RLAPI void BeginScissorMode(int x, int y, int width, int height); // Begin scissor mode (define screen area for following drawing)
 RLAPI void EndScissorMode(void);                                  // End scissor mode
+RLAPI void SetDrawCulling(bool enabled);                          // Set 2D draw culling, primitives outside the visible area (camera 2D and scissor aware) are skipped
+RLAPI DrawCullStats GetDrawCullStats(void);                       // Get 2D primitives culled and emitted since BeginDrawing()
 RLAPI void BeginVrStereoMode(VrStereoConfig config);              // Begin stereo rendering (requires VR simulator)
 RLAPI void EndVrStereoMode(void);                                 // End stereo rendering (requires VR simulator)
 
@@ -1040,6 +1089,12 @@ RLAPI double GetTime(void);                                       // Get elapsed
 // Misc. functions
 RLAPI int GetRandomValue(int min, int max);                       // Get a random value between min and max (both included)
 RLAPI void SetRandomSeed(unsigned int seed);                      // Set the seed for the random number generator
+RLAPI void SetRandomGeneratorSeed(RandomGenerator *generator, unsigned int seed);   // Seed a random generator (NULL: default generator, used by GetRandomValue())
+RLAPI unsigned int GetRandomBits(RandomGenerator *generator);                        // Get 32 random bits from generator (NULL: default generator)
+RLAPI int GetRandomValueFrom(RandomGenerator *generator, int min, int max);          // Get a random value between min and max (both included) from generator, unbiased
+RLAPI float GetRandomFloatFrom(RandomGenerator *generator, float min, float max);    // Get a random float in [min, max) from generator
+RLAPI void GetRandomValues(RandomGenerator *generator, int *values, int count, int min, int max);       // Fill array with random values between min and max (both included)
+RLAPI void GetRandomFloats(RandomGenerator *generator, float *values, int count, float min, float max); // Fill array with random floats in [min, max)
 RLAPI void TakeScreenshot(const char *fileName);                  // Takes a screenshot of current screen (filename extension defines format)
 RLAPI void SetConfigFlags(unsigned int flags);                    // Setup init configuration flags (view FLAGS)
 
@@ -1049,6 +1104,14 @@ RLAPI void *MemAlloc(unsigned int size);                          // Internal me
 RLAPI void *MemRealloc(void *ptr, unsigned int size);             // Internal memory reallocator
 RLAPI void MemFree(void *ptr);                                    // Internal memory free
 
+// Profiling functions
+// NOTE: Zones are recorded per thread without locks, name must outlive the profiler (use string literals)
+RLAPI void BeginProfileZone(const char *name);                    // Begin a named profiling zone on the calling thread
+RLAPI void EndProfileZone(void);                                  // End the last zone begun on the calling thread
+RLAPI unsigned long long GetProfileTime(void);                    // Get profiler clock time in nanoseconds (monotonic)
+RLAPI int GetProfileZones(ProfileZone *zones, int maxZones, unsigned long long since); // Get zones of all threads ended after since (newest first per thread), returns zones count
+RLAPI bool ExportProfileTrace(const char *fileName);              // Export recorded zones as Chrome trace event JSON, returns true on success
+
 RLAPI void OpenURL(const char *url);                              // Open URL with default system browser (if available)
 
 // Set custom callbacks
@@ -1167,6 +1230,7 @@ RLAPI void UpdateCameraPro(Camera *camera, Vector3 movement, Vector3 rotation, f
 // NOTE: It can be useful when using basic shapes and one single font,
 // defining a font char white rectangle would allow drawing everything in a single draw call
 RLAPI void SetShapesTexture(Texture2D texture, Rectangle source);       // Set texture and rectangle to be used on shapes drawing
+RLAPI void SetShapesMode(int mode);                                     // Set shapes drawing mode (tessellated or signed distance quads)
 
 // Basic shapes drawing functions
 RLAPI void DrawPixel(int posX, int posY, Color color);                                                   // Draw a pixel
@@ -1183,6 +1247,7 @@ RLAPI void DrawCircleSector(Vector2 center, float radius, float startAngle, floa
 RLAPI void DrawCircleSectorLines(Vector2 center, float radius, float startAngle, float endAngle, int segments, Color color); // Draw circle sector outline
 RLAPI void DrawCircleGradient(int centerX, int centerY, float radius, Color color1, Color color2);       // Draw a gradient-filled circle
 RLAPI void DrawCircleV(Vector2 center, float radius, Color color);                                       // Draw a color-filled circle (Vector version)
+RLAPI void DrawCircles(const Vector2 *centers, const float *radii, const Color *colors, int count);       // Draw multiple color-filled circles in one batch
 RLAPI void DrawCircleLines(int centerX, int centerY, float radius, Color color);                         // Draw circle outline
 RLAPI void DrawEllipse(int centerX, int centerY, float radiusH, float radiusV, Color color);             // Draw ellipse
 RLAPI void DrawEllipseLines(int centerX, int centerY, float radiusH, float radiusV, Color color);        // Draw ellipse outline
@@ -1311,6 +1376,10 @@ RLAPI bool IsTextureReady(Texture2D texture);
 RLAPI void UnloadTexture(Texture2D texture);                                                             // Unload texture from GPU memory (VRAM)
 RLAPI bool IsRenderTextureReady(RenderTexture2D target);                                                       // Check if a render texture is ready
 RLAPI void UnloadRenderTexture(RenderTexture2D target);                                                  // Unload render texture from GPU memory (VRAM)
+RLAPI int AddTextureAtlasImage(TextureAtlas *atlas, Image image);                                        // Register image into texture atlas (image data is copied), returns image index
+RLAPI bool BuildTextureAtlas(TextureAtlas *atlas, int padding);                                          // Pack registered images into atlas texture (VRAM)
+RLAPI Rectangle GetTextureAtlasRec(TextureAtlas atlas, int index, Rectangle source);                     // Get atlas texture rectangle for a source rectangle of a registered image
+RLAPI void UnloadTextureAtlas(TextureAtlas atlas);                                                       // Unload texture atlas texture and registered images
 RLAPI void UpdateTexture(Texture2D texture, const void *pixels);                                         // Update GPU texture with new data
 RLAPI void UpdateTextureRec(Texture2D texture, Rectangle rec, const void *pixels);                       // Update GPU texture rectangle with new data
 
@@ -1326,6 +1395,7 @@ RLAPI void DrawTextureEx(Texture2D texture, Vector2 position, float rotation, fl
 RLAPI void DrawTextureRec(Texture2D texture, Rectangle source, Vector2 position, Color tint);            // Draw a part of a texture defined by a rectangle
 RLAPI void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint); // Draw a part of a texture defined by a rectangle with 'pro' parameters
 RLAPI void DrawTextureNPatch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle dest, Vector2 origin, float rotation, Color tint); // Draws a texture (or part of it) that stretches or shrinks nicely
+RLAPI void DrawSprites(const SpriteInstance *sprites, int count);                                    // Draw an array of sprites, sorted by texture and instanced (one draw call per texture)
 
 // Color/pixel related functions
 RLAPI Color Fade(Color color, float alpha);                                 // Get color with alpha applied, alpha goes from 0.0f to 1.0f
@@ -1534,6 +1604,9 @@ RLAPI bool IsSoundPlaying(Sound sound);                               // Check i
 RLAPI void SetSoundVolume(Sound sound, float volume);                 // Set volume for a sound (1.0 is max level)
 RLAPI void SetSoundPitch(Sound sound, float pitch);                   // Set pitch for a sound (1.0 is base level)
 RLAPI void SetSoundPan(Sound sound, float pan);                       // Set pan for a sound (0.5 is center)
+RLAPI int PlaySoundVoice(Sound sound, float volume, float pitch, float pan, int priority); // Play a sound on a pooled voice, instances overlap (returns voice id, -1 if dropped)
+RLAPI void StopSoundVoice(int voice);                                 // Stop a pooled voice started with PlaySoundVoice()
+RLAPI void SetSoundMaxVoices(Sound sound, int maxVoices);             // Set max pooled voices playing a sound at once, oldest is restarted over it (0: no limit)
 RLAPI Wave WaveCopy(Wave wave);                                       // Copy a wave to a new wave
 RLAPI void WaveCrop(Wave *wave, int initSample, int finalSample);     // Crop a wave to defined samples range
 RLAPI void WaveFormat(Wave *wave, int sampleRate, int sampleSize, int channels); // Convert wave data to desired format
@@ -1548,6 +1621,7 @@ RLAPI void UnloadMusicStream(Music music);                            // Unload
 RLAPI void PlayMusicStream(Music music);                              // Start music playing
 RLAPI bool IsMusicStreamPlaying(Music music);                         // Check if music is playing
 RLAPI void UpdateMusicStream(Music music);                            // Updates buffers for music streaming
+RLAPI void SetMusicStreamAutoUpdate(Music music, bool autoUpdate);    // Set music buffers to be updated on a background decoding thread (no UpdateMusicStream() required)
 RLAPI void StopMusicStream(Music music);                              // Stop music playing
 RLAPI void PauseMusicStream(Music music);                             // Pause music playing
 RLAPI void ResumeMusicStream(Music music);                            // Resume playing paused music
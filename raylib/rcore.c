@@ -176,7 +176,7 @@
     #endif // OSs
 #endif // PLATFORM_DESKTOP
 
-#include <stdlib.h>                 // Required for: srand(), rand(), atexit()
+#include <stdlib.h>                 // Required for: srand(), atexit()
 #include <stdio.h>                  // Required for: sprintf() [Used in OpenURL()]
 #include <string.h>                 // Required for: strrchr(), strcmp(), strlen(), memset()
 #include <time.h>                   // Required for: time() [Used in InitTimer()]
@@ -504,6 +504,18 @@ typedef struct CoreData {
 #endif
         unsigned int frameCounter;          // Frame counter
     } Time;
+#if defined(SUPPORT_DRAW_CULLING)
+    struct {
+        bool enabled;                       // Draw culling enabled (SetDrawCulling())
+        bool active;                        // Draw culling applies to current drawing mode
+        bool mode3D;                        // Drawing in 3D mode, culling does not apply
+        bool scissor;                       // Scissor mode enabled
+        Rectangle scissorRec;               // Scissor rectangle (screen coordinates)
+        float minX, minY, maxX, maxY;       // Visible area bounds (2D drawing coordinates)
+        unsigned int culled;                // Primitives culled since BeginDrawing()
+        unsigned int emitted;               // Primitives emitted since BeginDrawing()
+    } Cull;
+#endif
 } CoreData;
 
 //----------------------------------------------------------------------------------
@@ -513,6 +525,10 @@ RLAPI const char *raylib_version = RAYLIB_VERSION;  // raylib version exported s
 
 static CoreData CORE = { 0 };               // Global CORE state context
 
+// Default random generator, used by GetRandomValue() and by the RandomGenerator functions when
+// no generator is provided. NOTE: Initial state is the expansion of seed 0, reseeded on InitWindow()
+static RandomGenerator defaultRandomGenerator = { { 0x7b1dcdaf, 0xe220a839, 0xa1b965f4, 0x6e789e6a } };
+
 #if defined(SUPPORT_SCREEN_CAPTURE)
 static int screenshotCounter = 0;           // Screenshots counter
 #endif
@@ -618,6 +634,12 @@ static bool eventsRecording = false;    // Record events
 extern void LoadFontDefault(void);          // [Module: text] Loads default font on InitWindow()
 extern void UnloadFontDefault(void);        // [Module: text] Unloads default font from GPU memory
 #endif
+#if defined(SUPPORT_MODULE_RSHAPES)
+extern void UnloadShapesShader(void);       // [Module: shapes] Unloads signed distance shapes shader from GPU memory
+#endif
+#if defined(SUPPORT_MODULE_RTEXTURES)
+extern void UnloadSpriteBatch(void);        // [Module: textures] Unloads sprite batch shader and buffers from GPU memory
+#endif
 
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
@@ -626,6 +648,9 @@ static void InitTimer(void);                            // Initialize timer (hi-
 static bool InitGraphicsDevice(int width, int height);  // Initialize graphics device
 static void SetupFramebuffer(int width, int height);    // Setup main framebuffer
 static void SetupViewport(int width, int height);       // Set viewport for a provided width and height
+#if defined(SUPPORT_DRAW_CULLING)
+static void UpdateDrawCulling(void);                    // Update visible area bounds for 2D draw culling
+#endif
 
 static void ScanDirectoryFiles(const char *basePath, FilePathList *list, const char *filter);   // Scan all files and directories in a base path
 static void ScanDirectoryFilesRecursively(const char *basePath, FilePathList *list, const char *filter);  // Scan all files and directories recursively from a base path
@@ -855,7 +880,7 @@ void InitWindow(int width, int height, const char *title)
     InitTimer();
 
     // Initialize random seed
-    srand((unsigned int)time(NULL));
+    SetRandomSeed((unsigned int)time(NULL));
 
     // Initialize base path for storage
     CORE.Storage.basePath = GetWorkingDirectory();
@@ -947,6 +972,12 @@ void CloseWindow(void)
 #if defined(SUPPORT_MODULE_RTEXT) && defined(SUPPORT_DEFAULT_FONT)
     UnloadFontDefault();        // WARNING: Module required: rtext
 #endif
+#if defined(SUPPORT_MODULE_RSHAPES)
+    UnloadShapesShader();       // WARNING: Module required: rshapes
+#endif
+#if defined(SUPPORT_MODULE_RTEXTURES)
+    UnloadSpriteBatch();        // WARNING: Module required: rtextures
+#endif
 
     rlglClose();                // De-init rlgl
 
@@ -1442,6 +1473,12 @@ void SetWindowState(unsigned int flags)
     {
         TRACELOG(LOG_WARNING, "RPI: Interlaced mode can only be configured before window initialization");
     }
+
+    // State change: FLAG_BATCH_STREAM_HINT
+    if (((CORE.Window.flags & FLAG_BATCH_STREAM_HINT) != (flags & FLAG_BATCH_STREAM_HINT)) && ((flags & FLAG_BATCH_STREAM_HINT) > 0))
+    {
+        TRACELOG(LOG_WARNING, "WINDOW: Batch streaming can only be configured before window initialization");
+    }
 #endif
 }
 
@@ -2124,11 +2161,21 @@ void BeginDrawing(void)
 
     //rlTranslatef(0.375, 0.375, 0);    // HACK to have 2D pixel-perfect drawing on OpenGL 1.1
                                         // NOTE: Not required with OpenGL 3.3+
+
+#if defined(SUPPORT_DRAW_CULLING)
+    CORE.Cull.culled = 0;
+    CORE.Cull.emitted = 0;
+    CORE.Cull.mode3D = false;
+    CORE.Cull.scissor = false;
+    UpdateDrawCulling();
+#endif
 }
 
 // End canvas drawing and swap buffers (double buffering)
 void EndDrawing(void)
 {
+    PROFILE_BEGIN("EndDrawing");
+
     rlDrawRenderBatchActive();      // Update and draw internal render batch
 
 #if defined(SUPPORT_GIF_RECORDING)
@@ -2191,7 +2238,9 @@ void EndDrawing(void)
 #endif
 
 #if !defined(SUPPORT_CUSTOM_FRAME_CONTROL)
+    PROFILE_BEGIN("SwapScreenBuffer");
     SwapScreenBuffer();                  // Copy back buffer to front buffer (screen)
+    PROFILE_END();
 
     // Frame time control system
     CORE.Time.current = GetTime();
@@ -2203,7 +2252,9 @@ void EndDrawing(void)
     // Wait for some milliseconds...
     if (CORE.Time.frame < CORE.Time.target)
     {
+        PROFILE_BEGIN("WaitTime");
         WaitTime(CORE.Time.target - CORE.Time.frame);
+        PROFILE_END();
 
         CORE.Time.current = GetTime();
         double waitTime = CORE.Time.current - CORE.Time.previous;
@@ -2227,6 +2278,8 @@ void EndDrawing(void)
 #endif
 
     CORE.Time.frameCounter++;
+
+    PROFILE_END();
 }
 
 // Initialize 2D mode with custom camera (2D)
@@ -2241,6 +2294,10 @@ void BeginMode2D(Camera2D camera)
 
     // Apply screen scaling if required
     rlMultMatrixf(MatrixToFloat(CORE.Window.screenScale));
+
+#if defined(SUPPORT_DRAW_CULLING)
+    UpdateDrawCulling();
+#endif
 }
 
 // Ends 2D mode with custom camera
@@ -2250,6 +2307,10 @@ void EndMode2D(void)
 
     rlLoadIdentity();               // Reset current matrix (modelview)
     rlMultMatrixf(MatrixToFloat(CORE.Window.screenScale)); // Apply screen scaling if required
+
+#if defined(SUPPORT_DRAW_CULLING)
+    UpdateDrawCulling();
+#endif
 }
 
 // Initializes 3D mode with custom camera (3D)
@@ -2289,6 +2350,11 @@ void BeginMode3D(Camera camera)
     rlMultMatrixf(MatrixToFloat(matView));      // Multiply modelview matrix by view matrix (camera)
 
     rlEnableDepthTest();            // Enable DEPTH_TEST for 3D
+
+#if defined(SUPPORT_DRAW_CULLING)
+    CORE.Cull.mode3D = true;
+    UpdateDrawCulling();
+#endif
 }
 
 // Ends 3D mode and returns to default 2D orthographic mode
@@ -2305,6 +2371,11 @@ void EndMode3D(void)
     rlMultMatrixf(MatrixToFloat(CORE.Window.screenScale)); // Apply screen scaling if required
 
     rlDisableDepthTest();           // Disable DEPTH_TEST for 2D
+
+#if defined(SUPPORT_DRAW_CULLING)
+    CORE.Cull.mode3D = false;
+    UpdateDrawCulling();
+#endif
 }
 
 // Initializes render texture for drawing
@@ -2335,6 +2406,10 @@ void BeginTextureMode(RenderTexture2D target)
     // calculation when using BeginMode3D()
     CORE.Window.currentFbo.width = target.texture.width;
     CORE.Window.currentFbo.height = target.texture.height;
+
+#if defined(SUPPORT_DRAW_CULLING)
+    UpdateDrawCulling();
+#endif
 }
 
 // Ends drawing to render texture
@@ -2350,6 +2425,10 @@ void EndTextureMode(void)
     // Reset current fbo to screen size
     CORE.Window.currentFbo.width = CORE.Window.render.width;
     CORE.Window.currentFbo.height = CORE.Window.render.height;
+
+#if defined(SUPPORT_DRAW_CULLING)
+    UpdateDrawCulling();
+#endif
 }
 
 // Begin custom shader mode
@@ -2399,6 +2478,12 @@ void BeginScissorMode(int x, int y, int width, int height)
         rlScissor(x, CORE.Window.currentFbo.height - (y + height), width, height);
     }
 #endif
+
+#if defined(SUPPORT_DRAW_CULLING)
+    CORE.Cull.scissor = true;
+    CORE.Cull.scissorRec = (Rectangle){ (float)x, (float)y, (float)width, (float)height };
+    UpdateDrawCulling();
+#endif
 }
 
 // End scissor mode
@@ -2406,8 +2491,58 @@ void EndScissorMode(void)
 {
     rlDrawRenderBatchActive();      // Update and draw internal render batch
     rlDisableScissorTest();
+
+#if defined(SUPPORT_DRAW_CULLING)
+    CORE.Cull.scissor = false;
+    UpdateDrawCulling();
+#endif
 }
 
+// Set 2D draw culling
+// NOTE: Visible area follows BeginMode2D(), BeginScissorMode() and BeginTextureMode(),
+// matrices set directly with rlgl are not tracked, vertices transformed by rlPushMatrix() are never culled
+void SetDrawCulling(bool enabled)
+{
+#if defined(SUPPORT_DRAW_CULLING)
+    CORE.Cull.enabled = enabled;
+    UpdateDrawCulling();
+#else
+    if (enabled) TRACELOG(LOG_WARNING, "SYSTEM: Draw culling not supported (SUPPORT_DRAW_CULLING)");
+#endif
+}
+
+// Get 2D primitives culled and emitted since BeginDrawing()
+DrawCullStats GetDrawCullStats(void)
+{
+    DrawCullStats stats = { 0 };
+#if defined(SUPPORT_DRAW_CULLING)
+    stats.culled = CORE.Cull.culled;
+    stats.emitted = CORE.Cull.emitted;
+#endif
+    return stats;
+}
+
+#if defined(SUPPORT_DRAW_CULLING)
+// Check if a 2D primitive bounding box is outside the visible area, counting it as culled or emitted
+// NOTE: Used by shapes and textures modules, bounds are given in 2D drawing coordinates,
+// recorded commands are never culled nor counted, they can be submitted or drawn later under another view
+// NOTE: Checked first, recording threads must not touch CORE.Cull (only written by the main thread)
+bool CheckDrawCulling(float minX, float minY, float maxX, float maxY)
+{
+    if (rlIsCommandBufferRecording()) return false;
+
+    if (CORE.Cull.active && !rlIsTransformRequired() &&
+        ((maxX < CORE.Cull.minX) || (minX > CORE.Cull.maxX) || (maxY < CORE.Cull.minY) || (minY > CORE.Cull.maxY)))
+    {
+        CORE.Cull.culled++;
+        return true;
+    }
+
+    CORE.Cull.emitted++;
+    return false;
+}
+#endif
+
 // Begin VR drawing configuration
 void BeginVrStereoMode(VrStereoConfig config)
 {
@@ -2939,11 +3074,80 @@ void TakeScreenshot(const char *fileName)
 }
 
 // Get a random value between min and max (both included)
-// WARNING: Ranges higher than RAND_MAX will return invalid results
-// More specifically, if (max - min) > INT_MAX there will be an overflow,
-// and otherwise if (max - min) > RAND_MAX the random value will incorrectly never exceed a certain threshold
+// NOTE: Uses the default random generator, any int range is valid and values are unbiased
 int GetRandomValue(int min, int max)
 {
+    return GetRandomValueFrom(&defaultRandomGenerator, min, max);
+}
+
+// Set the seed for the random number generator
+// NOTE: Seeds the default random generator and also rand(), for code still using it directly
+void SetRandomSeed(unsigned int seed)
+{
+    SetRandomGeneratorSeed(&defaultRandomGenerator, seed);
+    srand(seed);
+}
+
+// Seed a random generator, same seed always gives the same sequence
+// NOTE: State is expanded from the seed with splitmix64, so it is never all zero
+void SetRandomGeneratorSeed(RandomGenerator *generator, unsigned int seed)
+{
+    if (generator == NULL) generator = &defaultRandomGenerator;
+
+    unsigned long long x = seed;
+
+    for (int i = 0; i < 2; i++)
+    {
+        x += 0x9e3779b97f4a7c15ULL;
+        unsigned long long z = x;
+        z = (z ^ (z >> 30))*0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27))*0x94d049bb133111ebULL;
+        z = z ^ (z >> 31);
+
+        generator->state[i*2] = (unsigned int)z;
+        generator->state[i*2 + 1] = (unsigned int)(z >> 32);
+    }
+}
+
+// Get 32 random bits from generator (xoshiro128**)
+unsigned int GetRandomBits(RandomGenerator *generator)
+{
+    if (generator == NULL) generator = &defaultRandomGenerator;
+
+    unsigned int *s = generator->state;
+    unsigned int result = s[1]*5;
+    result = ((result << 7) | (result >> 25))*9;
+
+    unsigned int t = s[1] << 9;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = (s[3] << 11) | (s[3] >> 21);
+
+    return result;
+}
+
+// Get a random offset in [0, range - 1], range 0 means the full 32 bit range
+// NOTE: Multiply-shift reduction rejecting the few biased low products (Lemire's method),
+// threshold is (2^32 - range)%range, passed in so bulk generation computes it once
+static unsigned int GetRandomRange(RandomGenerator *generator, unsigned int range, unsigned int threshold)
+{
+    if (range == 0) return GetRandomBits(generator);
+
+    unsigned long long product = (unsigned long long)GetRandomBits(generator)*range;
+
+    while ((unsigned int)product < threshold) product = (unsigned long long)GetRandomBits(generator)*range;
+
+    return (unsigned int)(product >> 32);
+}
+
+// Get a random value between min and max (both included) from generator
+int GetRandomValueFrom(RandomGenerator *generator, int min, int max)
+{
+    if (generator == NULL) generator = &defaultRandomGenerator;
+
     if (min > max)
     {
         int tmp = max;
@@ -2951,18 +3155,46 @@ int GetRandomValue(int min, int max)
         min = tmp;
     }
 
-    if ((unsigned int)(max - min) > (unsigned int)RAND_MAX)
+    unsigned int range = (unsigned int)max - (unsigned int)min + 1;
+    unsigned int threshold = (range > 0)? (0u - range)%range : 0;
+
+    return (int)((unsigned int)min + GetRandomRange(generator, range, threshold));
+}
+
+// Get a random float in [min, max) from generator
+float GetRandomFloatFrom(RandomGenerator *generator, float min, float max)
+{
+    if (generator == NULL) generator = &defaultRandomGenerator;
+
+    float unit = (float)(GetRandomBits(generator) >> 8)*(1.0f/16777216.0f);     // 24 random bits, [0, 1)
+
+    return min + (max - min)*unit;
+}
+
+// Fill values array with random values between min and max (both included)
+void GetRandomValues(RandomGenerator *generator, int *values, int count, int min, int max)
+{
+    if (generator == NULL) generator = &defaultRandomGenerator;
+
+    if (min > max)
     {
-        TRACELOG(LOG_WARNING, "Invalid GetRandomValue() arguments, range should not be higher than %i", RAND_MAX);
+        int tmp = max;
+        max = min;
+        min = tmp;
     }
 
-    return (rand()%(abs(max - min) + 1) + min);
+    unsigned int range = (unsigned int)max - (unsigned int)min + 1;
+    unsigned int threshold = (range > 0)? (0u - range)%range : 0;
+
+    for (int i = 0; i < count; i++) values[i] = (int)((unsigned int)min + GetRandomRange(generator, range, threshold));
 }
 
-// Set the seed for the random number generator
-void SetRandomSeed(unsigned int seed)
+// Fill values array with random floats in [min, max)
+void GetRandomFloats(RandomGenerator *generator, float *values, int count, float min, float max)
 {
-    srand(seed);
+    if (generator == NULL) generator = &defaultRandomGenerator;
+
+    for (int i = 0; i < count; i++) values[i] = min + (max - min)*((float)(GetRandomBits(generator) >> 8)*(1.0f/16777216.0f));
 }
 
 // Check if the file exists
@@ -4759,6 +4991,9 @@ static bool InitGraphicsDevice(int width, int height)
     rlLoadExtensions(eglGetProcAddress);
 #endif
 
+    // Select default render batch vertex streaming, falls back to orphaned buffers if persistent mapping is not supported
+    if ((CORE.Window.flags & FLAG_BATCH_STREAM_HINT) > 0) rlSetDefaultBatchStream(RL_BATCH_STREAM_INTERLEAVED);
+
     // Initialize OpenGL context (states and resources)
     // NOTE: CORE.Window.currentFbo.width and CORE.Window.currentFbo.height not used, just stored as globals in rlgl
     rlglInit(CORE.Window.currentFbo.width, CORE.Window.currentFbo.height);
@@ -4804,6 +5039,48 @@ static void SetupViewport(int width, int height)
     rlLoadIdentity();                   // Reset current matrix (modelview)
 }
 
+#if defined(SUPPORT_DRAW_CULLING)
+// Update visible area bounds for 2D draw culling
+// NOTE: Visible area is the current framebuffer (intersected with the scissor rectangle),
+// in the orthographic projection units, mapped back to 2D drawing coordinates by the inverse modelview
+static void UpdateDrawCulling(void)
+{
+    // Culling only applies to 2D, OpenGL 1.1 matrix stack changes can not be checked
+    CORE.Cull.active = CORE.Cull.enabled && !CORE.Cull.mode3D && (rlGetVersion() != RL_OPENGL_11);
+    if (!CORE.Cull.active) return;
+
+    // NOTE: A 1 pixel margin is kept for lines and antialiased edges
+    float minX = -1.0f;
+    float minY = -1.0f;
+    float maxX = (float)CORE.Window.currentFbo.width + 1.0f;
+    float maxY = (float)CORE.Window.currentFbo.height + 1.0f;
+
+    if (CORE.Cull.scissor)
+    {
+        // Scissor rectangle is defined in screen coordinates, scaled on HighDPI
+        Vector2 scale = { CORE.Window.screenScale.m0, CORE.Window.screenScale.m5 };
+        minX = fmaxf(minX, CORE.Cull.scissorRec.x*scale.x - 1.0f);
+        minY = fmaxf(minY, CORE.Cull.scissorRec.y*scale.y - 1.0f);
+        maxX = fminf(maxX, (CORE.Cull.scissorRec.x + CORE.Cull.scissorRec.width)*scale.x + 1.0f);
+        maxY = fminf(maxY, (CORE.Cull.scissorRec.y + CORE.Cull.scissorRec.height)*scale.y + 1.0f);
+    }
+
+    Matrix invModelview = MatrixInvert(rlGetMatrixModelview());
+    Vector3 corners[4] = {
+        Vector3Transform((Vector3){ minX, minY, 0.0f }, invModelview),
+        Vector3Transform((Vector3){ maxX, minY, 0.0f }, invModelview),
+        Vector3Transform((Vector3){ maxX, maxY, 0.0f }, invModelview),
+        Vector3Transform((Vector3){ minX, maxY, 0.0f }, invModelview)
+    };
+
+    // Camera rotation turns the visible area, its bounding box is used
+    CORE.Cull.minX = fminf(fminf(corners[0].x, corners[1].x), fminf(corners[2].x, corners[3].x));
+    CORE.Cull.minY = fminf(fminf(corners[0].y, corners[1].y), fminf(corners[2].y, corners[3].y));
+    CORE.Cull.maxX = fmaxf(fmaxf(corners[0].x, corners[1].x), fmaxf(corners[2].x, corners[3].x));
+    CORE.Cull.maxY = fmaxf(fmaxf(corners[0].y, corners[1].y), fmaxf(corners[2].y, corners[3].y));
+}
+#endif
+
 // Compute framebuffer size relative to screen size and display size
 // NOTE: Global variables CORE.Window.render.width/CORE.Window.render.height and CORE.Window.renderOffset.x/CORE.Window.renderOffset.y can be modified
 static void SetupFramebuffer(int width, int height)
@@ -4993,6 +5270,8 @@ void SwapScreenBuffer(void)
 // Register all input events
 void PollInputEvents(void)
 {
+    PROFILE_BEGIN("PollInputEvents");
+
 #if defined(SUPPORT_GESTURES_SYSTEM)
     // NOTE: Gestures update must be called every frame to reset gestures correctly
     // because ProcessGestureEvent() is just called on an event, not every frame
@@ -5253,6 +5532,8 @@ void PollInputEvents(void)
     // NOTE: Mouse input events polling is done asynchronously in another pthread - EventThread()
     // NOTE: Gamepad (Joystick) input events polling is done asynchonously in another pthread - GamepadThread()
 #endif
+
+    PROFILE_END();
 }
 
 // Scan all files and directories in a base path
@@ -5673,7 +5954,7 @@ static void AndroidCommandCallback(struct android_app *app, int32_t cmd)
                     InitTimer();
 
                     // Initialize random seed
-                    srand((unsigned int)time(NULL));
+                    SetRandomSeed((unsigned int)time(NULL));
 
                 #if defined(SUPPORT_MODULE_RTEXT) && defined(SUPPORT_DEFAULT_FONT)
                     // Load default font
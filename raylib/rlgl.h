@@ -50,8 +50,10 @@
 *
 *   #define RL_DEFAULT_BATCH_BUFFER_ELEMENTS   8192    // Default internal render batch elements limits
 *   #define RL_DEFAULT_BATCH_BUFFERS              1    // Default number of batch buffers (multi-buffering)
+*   #define RL_DEFAULT_BATCH_STREAM_BUFFERS       3    // Default number of batch buffers when streaming interleaved vertices (ring)
 *   #define RL_DEFAULT_BATCH_DRAWCALLS          256    // Default number of batch draw calls (by state changes: mode, texture)
 *   #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS    4    // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
+*   #define RL_DEFAULT_DRAW_QUEUE_LAYERS          8    // Number of draw queue layers, drawn in increasing order (rlSetDrawLayer())
 *
 *   #define RL_MAX_MATRIX_STACK_SIZE             32    // Maximum size of internal Matrix stack
 *   #define RL_MAX_SHADER_LOCATIONS              32    // Maximum number of shader locations supported
@@ -129,6 +131,12 @@
     #define TRACELOGD(...) (void)0
 #endif
 
+// Support PROFILE macros
+#ifndef PROFILE_BEGIN
+    #define PROFILE_BEGIN(name) (void)0
+    #define PROFILE_END() (void)0
+#endif
+
 // Allow custom memory allocators
 #ifndef RL_MALLOC
     #define RL_MALLOC(sz)     malloc(sz)
@@ -204,12 +212,18 @@
 #ifndef RL_DEFAULT_BATCH_BUFFERS
     #define RL_DEFAULT_BATCH_BUFFERS                 1      // Default number of batch buffers (multi-buffering)
 #endif
+#ifndef RL_DEFAULT_BATCH_STREAM_BUFFERS
+    #define RL_DEFAULT_BATCH_STREAM_BUFFERS          3      // Default number of batch buffers when streaming interleaved vertices (ring)
+#endif
 #ifndef RL_DEFAULT_BATCH_DRAWCALLS
     #define RL_DEFAULT_BATCH_DRAWCALLS             256      // Default number of batch draw calls (by state changes: mode, texture)
 #endif
 #ifndef RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS
     #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS       4      // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
 #endif
+#ifndef RL_DEFAULT_DRAW_QUEUE_LAYERS
+    #define RL_DEFAULT_DRAW_QUEUE_LAYERS             8      // Number of draw queue layers, drawn in increasing order (rlSetDrawLayer())
+#endif
 
 // Internal Matrix stack
 #ifndef RL_MAX_MATRIX_STACK_SIZE
@@ -333,6 +347,13 @@ typedef struct Matrix {
 #define RL_MATRIX_TYPE
 #endif
 
+// Interleaved vertex, used by render batches streaming with RL_BATCH_STREAM_INTERLEAVED
+typedef struct rlStreamVertex {
+    float position[3];          // Vertex position (XYZ) (shader-location = 0)
+    float texcoord[2];          // Vertex texture coordinates (UV) (shader-location = 1)
+    unsigned char color[4];     // Vertex color (RGBA) (shader-location = 3)
+} rlStreamVertex;
+
 // Dynamic vertex buffers (position + texcoords + colors + indices arrays)
 typedef struct rlVertexBuffer {
     int elementCount;           // Number of elements in the buffer (QUADS)
@@ -348,6 +369,9 @@ typedef struct rlVertexBuffer {
 #endif
     unsigned int vaoId;         // OpenGL Vertex Array Object id
     unsigned int vboId[4];      // OpenGL Vertex Buffer Objects id (4 types of vertex data)
+
+    rlStreamVertex *streamVertices; // Interleaved vertex data (RL_BATCH_STREAM_INTERLEAVED), mapped GPU memory if persistent
+    void *fence;                // OpenGL sync object signaled once the GPU is done with the buffer (persistent mapping)
 } rlVertexBuffer;
 
 // Draw call type
@@ -375,8 +399,52 @@ typedef struct rlRenderBatch {
     rlDrawCall *draws;          // Draw calls array, depends on textureId
     int drawCounter;            // Draw calls counter
     float currentDepth;         // Current depth value for next draw
+
+    int stream;                 // Vertex streaming mode (rlBatchStream)
+    bool streamMapped;          // Stream buffers are persistently mapped (else orphaned and uploaded on draw)
 } rlRenderBatch;
 
+// rlCommandBuffer type, vertices and draws recorded on any thread, submitted to a render batch later
+// NOTE: Vertices are stored already interleaved, draws only track mode and texture changes (like rlRenderBatch)
+typedef struct rlCommandBuffer {
+    int vertexCount;            // Number of recorded vertices
+    int vertexCapacity;         // Number of vertices allocated (grows while recording)
+    rlStreamVertex *vertices;   // Recorded vertices (position + texcoord + color)
+
+    int drawCount;              // Number of recorded draws
+    int drawCapacity;           // Number of draws allocated (grows while recording)
+    rlDrawCall *draws;          // Recorded draws (vertexAlignment is not used)
+
+    float currentDepth;         // Current depth value for next draw
+    float texcoordx, texcoordy; // Current texture coordinate (added on rlVertex*())
+    unsigned char colorr, colorg, colorb, colora; // Current color (added on rlVertex*())
+} rlCommandBuffer;
+
+// rlStaticLayer type, recorded commands kept in GPU memory and drawn again every frame
+// NOTE: Quads are split in triangles on load, consecutive draws with same mode and texture are merged
+typedef struct rlStaticLayer {
+    unsigned int vaoId;         // OpenGL Vertex Array Object id (0 if VAO not supported)
+    unsigned int vboId;         // OpenGL Vertex Buffer Object id (interleaved vertices)
+    int vertexCount;            // Number of vertices in the buffer
+    int drawCount;              // Number of draws
+    rlDrawCall *draws;          // Draws (mode is RL_LINES or RL_TRIANGLES, vertexAlignment is not used)
+} rlStaticLayer;
+
+// rlBatchStats type, render batch counters accumulated since last rlResetBatchStats()
+// NOTE: Texture and mode changes only start a new draw call inside the batch,
+// they force a flush when the draw calls array is full (counted as drawCallOverflows)
+typedef struct rlBatchStats {
+    int drawCalls;              // Draw calls issued (render batch draws, vertex arrays, instanced draws)
+    int flushes;                // Render batch flushes with vertex data (sum of the three reasons below)
+    int stateFlushes;           // Flushes requested by state changes or frame end (rlDrawRenderBatchActive(), shaders, matrices, framebuffers...)
+    int vertexOverflows;        // Flushes forced by a full vertex buffer (RL_DEFAULT_BATCH_BUFFER_ELEMENTS)
+    int drawCallOverflows;      // Flushes forced by a full draw calls array (RL_DEFAULT_BATCH_DRAWCALLS)
+    int textureChanges;         // Draw calls started inside the batch by a texture change
+    int modeChanges;            // Draw calls started inside the batch by a primitive mode change (lines, triangles, quads)
+    int vertices;               // Vertices drawn by render batch flushes and vertex array draws (alignment padding not included)
+    int bytesUploaded;          // Vertex bytes sent to GPU (render batch streams and rlUpdateVertexBuffer*())
+} rlBatchStats;
+
 // OpenGL version
 typedef enum {
     RL_OPENGL_11 = 1,           // OpenGL 1.1
@@ -386,6 +454,12 @@ typedef enum {
     RL_OPENGL_ES_20             // OpenGL ES 2.0 (GLSL 100)
 } rlGlVersion;
 
+// Render batch vertex streaming mode
+typedef enum {
+    RL_BATCH_STREAM_SEPARATE = 0,   // Separate position, texcoord and color arrays, uploaded on draw (one glBufferSubData() each)
+    RL_BATCH_STREAM_INTERLEAVED     // Interleaved vertices written straight into a ring of persistently mapped buffers (orphaned buffers if not supported)
+} rlBatchStream;
+
 // Trace log level
 // NOTE: Organized by priority level
 typedef enum {
@@ -654,19 +728,52 @@ RLAPI int rlGetFramebufferHeight(void);                 // Get default framebuff
 RLAPI unsigned int rlGetTextureIdDefault(void);         // Get default texture id
 RLAPI unsigned int rlGetShaderIdDefault(void);          // Get default shader id
 RLAPI int *rlGetShaderLocsDefault(void);                // Get default shader locations
+RLAPI unsigned int rlGetShaderIdCurrent(void);          // Get current shader id (used by render batch)
 
 // Render batch management
 // NOTE: rlgl provides a default render batch to behave like OpenGL 1.1 immediate mode
 // but this render batch API is exposed in case of custom batches are required
 RLAPI rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements);  // Load a render batch system
+RLAPI rlRenderBatch rlLoadRenderBatchStream(int numBuffers, int bufferElements, int stream); // Load a render batch system with a vertex streaming mode (rlBatchStream)
+RLAPI void rlSetDefaultBatchStream(int stream);                            // Set default render batch vertex streaming mode (call before rlglInit())
 RLAPI void rlUnloadRenderBatch(rlRenderBatch batch);                        // Unload render batch system
 RLAPI void rlDrawRenderBatch(rlRenderBatch *batch);                         // Draw render batch data (Update->Draw->Reset)
 RLAPI void rlSetRenderBatchActive(rlRenderBatch *batch);                    // Set the active render batch for rlgl (NULL for default internal)
 RLAPI void rlDrawRenderBatchActive(void);                                   // Update and draw internal render batch
 RLAPI bool rlCheckRenderBatchLimit(int vCount);                             // Check internal buffer overflow for a given number of vertex
+RLAPI rlBatchStats rlGetBatchStats(void);                                   // Get render batch statistics accumulated since last reset
+RLAPI void rlResetBatchStats(void);                                         // Reset render batch statistics (i.e. once per frame, after EndDrawing())
 
 RLAPI void rlSetTexture(unsigned int id);               // Set current texture for render batch and check buffers limits
 
+// Command buffers management
+// NOTE: Between rlBeginCommandBuffer() and rlEndCommandBuffer(), rlBegin(), rlEnd(), rlVertex*(), rlTexCoord2f(),
+// rlColor*() and rlSetTexture() called on that thread record into the command buffer instead of the render batch,
+// so worker threads can generate vertices while the main thread submits the buffers in order
+RLAPI rlCommandBuffer rlLoadCommandBuffer(int vertexCount);                 // Load a command buffer with an initial vertex capacity
+RLAPI void rlUnloadCommandBuffer(rlCommandBuffer buffer);                   // Unload command buffer
+RLAPI void rlBeginCommandBuffer(rlCommandBuffer *buffer);                   // Begin recording on the calling thread (previous commands are cleared)
+RLAPI void rlEndCommandBuffer(void);                                        // End recording on the calling thread
+RLAPI void rlSubmitCommandBuffer(const rlCommandBuffer *buffer);            // Append recorded commands to the active render batch (main thread)
+RLAPI bool rlIsCommandBufferRecording(void);                                // Check if the calling thread is recording a command buffer
+
+// Static layers management
+// NOTE: Commands recorded once into a command buffer are uploaded to a static vertex buffer,
+// drawing the layer needs no vertex generation or upload, reload it when its content changes
+RLAPI rlStaticLayer rlLoadStaticLayer(const rlCommandBuffer *buffer);      // Load static layer from recorded commands (main thread)
+RLAPI void rlUnloadStaticLayer(rlStaticLayer layer);                        // Unload static layer from GPU memory
+RLAPI void rlDrawStaticLayer(const rlStaticLayer *layer, Matrix transform); // Draw static layer with current shader, transform is applied before modelview
+
+// Draw queue management
+// NOTE: While enabled, batch draws on the main thread are deferred and sorted by layer, then texture
+// and mode, so draws sharing texture and mode merge in one draw call. Within a layer, only draws with
+// same texture and mode keep their relative order, use layers for anything that must stay on top.
+// Queued draws are submitted on every render batch flush (shader, blending, scissor, camera and
+// framebuffer changes, EndDrawing()...) so state changes keep their place
+RLAPI void rlEnableDrawQueue(void);                                         // Enable draw queue, batch draws are deferred (main thread)
+RLAPI void rlDisableDrawQueue(void);                                        // Disable draw queue, queued draws are submitted to the render batch
+RLAPI void rlSetDrawLayer(int layer);                                       // Set layer for next queued draws [0..RL_DEFAULT_DRAW_QUEUE_LAYERS-1]
+
 //------------------------------------------------------------------------------------------------------------------------
 
 // Vertex buffers management
@@ -675,6 +782,7 @@ RLAPI unsigned int rlLoadVertexBuffer(const void *buffer, int size, bool dynamic
 RLAPI unsigned int rlLoadVertexBufferElement(const void *buffer, int size, bool dynamic);     // Load a new attributes element buffer
 RLAPI void rlUpdateVertexBuffer(unsigned int bufferId, const void *data, int dataSize, int offset);     // Update GPU buffer with new data
 RLAPI void rlUpdateVertexBufferElements(unsigned int id, const void *data, int dataSize, int offset);   // Update vertex buffer elements with new data
+RLAPI void rlOrphanVertexBuffer(unsigned int id, int size);              // Orphan vertex buffer storage, next update does not wait for draws using the old one
 RLAPI void rlUnloadVertexArray(unsigned int vaoId);
 RLAPI void rlUnloadVertexBuffer(unsigned int vboId);
 RLAPI void rlSetVertexAttribute(unsigned int index, int compSize, int type, bool normalized, int stride, const void *pointer);
@@ -735,6 +843,7 @@ RLAPI void rlBindImageTexture(unsigned int id, unsigned int index, int format, b
 RLAPI Matrix rlGetMatrixModelview(void);                                  // Get internal modelview matrix
 RLAPI Matrix rlGetMatrixProjection(void);                                 // Get internal projection matrix
 RLAPI Matrix rlGetMatrixTransform(void);                                  // Get internal accumulated transform matrix
+RLAPI bool rlIsTransformRequired(void);                                   // Check if vertices are transformed on rlVertex*() (inside rlPushMatrix())
 RLAPI Matrix rlGetMatrixProjectionStereo(int eye);                        // Get internal projection matrix for stereo render (selected eye)
 RLAPI Matrix rlGetMatrixViewOffsetStereo(int eye);                        // Get internal view offset matrix for stereo render (selected eye)
 RLAPI void rlSetMatrixProjection(Matrix proj);                            // Set a custom projection matrix (replaces internal projection matrix)
@@ -812,8 +921,8 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
     #endif
 #endif
 
-#include <stdlib.h>                     // Required for: malloc(), free()
-#include <string.h>                     // Required for: strcmp(), strlen() [Used in rlglInit(), on extensions loading]
+#include <stdlib.h>                     // Required for: malloc(), free(), qsort()
+#include <string.h>                     // Required for: strcmp(), strlen() [Used in rlglInit(), on extensions loading], memcpy()
 #include <math.h>                       // Required for: sqrtf(), sinf(), cosf(), floor(), log()
 
 //----------------------------------------------------------------------------------
@@ -829,6 +938,11 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
     #define RAD2DEG (180.0f/PI)
 #endif
 
+// Render batch flush reasons, counted in rlBatchStats
+#define RL_FLUSH_STATE                  0       // State change or explicit rlDrawRenderBatchActive()
+#define RL_FLUSH_VERTEX_OVERFLOW        1       // Vertex buffer full
+#define RL_FLUSH_DRAWCALL_OVERFLOW      2       // Draw calls array full
+
 #ifndef GL_SHADING_LANGUAGE_VERSION
     #define GL_SHADING_LANGUAGE_VERSION         0x8B8C
 #endif
@@ -943,9 +1057,17 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Draw queue entry, a recorded draw and where its vertices start
+typedef struct rlQueuedDraw {
+    const rlDrawCall *draw;                 // Recorded draw
+    int vertexOffset;                       // First vertex of the draw in the layer command buffer
+    int index;                              // Recording order, keeps sorting stable
+} rlQueuedDraw;
+
 typedef struct rlglData {
     rlRenderBatch *currentBatch;            // Current render batch
     rlRenderBatch defaultBatch;             // Default internal render batch
+    int defaultBatchStream;                 // Default internal render batch vertex streaming mode (rlBatchStream)
 
     struct {
         int vertexCounter;                  // Current active render batch vertex counter (generic, used for all batches)
@@ -1008,11 +1130,24 @@ typedef struct rlglData {
         bool texAnisoFilter;                // Anisotropic texture filtering support (GL_EXT_texture_filter_anisotropic)
         bool computeShader;                 // Compute shaders support (GL_ARB_compute_shader)
         bool ssbo;                          // Shader storage buffer object support (GL_ARB_shader_storage_buffer_object)
+        bool bufferStorage;                 // Persistently mapped buffers support (GL_ARB_buffer_storage + GL_ARB_sync)
 
         float maxAnisotropyLevel;           // Maximum anisotropy level supported (minimum is 2.0f)
         int maxDepthBits;                   // Maximum bits for depth component
 
     } ExtSupported;     // Extensions supported flags
+    struct {
+        rlBatchStats counters;              // Render batch statistics since last rlResetBatchStats()
+        int flushReason;                    // Reason of next rlDrawRenderBatch() (RL_FLUSH_*), reset on every flush
+    } Stats;            // Render batch statistics
+    struct {
+        bool active;                        // Draw queue enabled, main thread batch draws are deferred
+        bool flushing;                      // Queued draws being submitted, render batch flushes are not barriers
+        int layer;                          // Current layer for queued draws
+        rlCommandBuffer layers[RL_DEFAULT_DRAW_QUEUE_LAYERS];  // Queued draws, one command buffer per layer
+        rlQueuedDraw *order;                // Sorting space for the draws of one layer
+        int orderCapacity;                  // Number of entries allocated in order
+    } Queue;            // Deferred draw queue
 } rlglData;
 
 typedef void *(*rlglLoadProc)(const char *name);   // OpenGL extension functions loader signature (same as GLADloadproc)
@@ -1024,6 +1159,15 @@ typedef void *(*rlglLoadProc)(const char *name);   // OpenGL extension functions
 //----------------------------------------------------------------------------------
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 static rlglData RLGL = { 0 };
+
+// NOTE: Every thread records into its own command buffer, so recording needs no locks
+#if defined(_MSC_VER)
+static __declspec(thread) rlCommandBuffer *rlRecordBuffer = NULL;   // Command buffer recording on calling thread
+static __declspec(thread) rlCommandBuffer *rlRecordSuspended = NULL; // Command buffer suspended by rlBeginCommandBuffer() (draw queue)
+#else
+static __thread rlCommandBuffer *rlRecordBuffer = NULL;             // Command buffer recording on calling thread
+static __thread rlCommandBuffer *rlRecordSuspended = NULL;          // Command buffer suspended by rlBeginCommandBuffer() (draw queue)
+#endif
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
 #if defined(GRAPHICS_API_OPENGL_ES2)
@@ -1044,6 +1188,13 @@ static PFNGLVERTEXATTRIBDIVISOREXTPROC glVertexAttribDivisor = NULL;
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 static void rlLoadShaderDefault(void);      // Load default shader
 static void rlUnloadShaderDefault(void);    // Unload default shader
+static void rlRecordDraw(rlCommandBuffer *buffer, int mode, unsigned int textureId);   // Start a new recorded draw if required
+static void rlReserveCommandBuffer(rlCommandBuffer *buffer, int vertexCount);          // Grow recorded vertices capacity if required
+static void rlResetCommandBuffer(rlCommandBuffer *buffer);                              // Clear recorded commands and recording state
+static void rlSubmitRecordedDraw(const rlDrawCall *draw, const rlStreamVertex *vertices, bool transform); // Append one recorded draw to the active render batch
+static bool rlIsDrawQueueBuffer(const rlCommandBuffer *buffer);                         // Check if a command buffer is one of the draw queue layers
+static void rlFlushDrawQueue(void);                                                     // Sort and submit queued draws to the active render batch
+static int rlCompareQueuedDraws(const void *a, const void *b);                          // Compare queued draws by texture, mode and recording order
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
 static char *rlGetCompressedFormatName(int format); // Get compressed format official GL identifier name
 #endif  // RLGL_SHOW_GL_DETAILS_INFO
@@ -1327,6 +1478,13 @@ void rlColor4f(float x, float y, float z, float w) { glColor4f(x, y, z, w); }
 // Initialize drawing mode (how to organize vertex)
 void rlBegin(int mode)
 {
+    rlCommandBuffer *record = rlRecordBuffer;
+    if (record != NULL)
+    {
+        if (record->draws[record->drawCount - 1].mode != mode) rlRecordDraw(record, mode, RLGL.State.defaultTextureId);
+        return;
+    }
+
     // Draw mode can be RL_LINES, RL_TRIANGLES and RL_QUADS
     // NOTE: In all three cases, vertex are accumulated over default internal vertex buffer
     if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode != mode)
@@ -1346,10 +1504,15 @@ void rlBegin(int mode)
             {
                 RLGL.State.vertexCounter += RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment;
                 RLGL.currentBatch->drawCounter++;
+                RLGL.Stats.counters.modeChanges++;
             }
         }
 
-        if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlDrawRenderBatch(RLGL.currentBatch);
+        if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS)
+        {
+            RLGL.Stats.flushReason = RL_FLUSH_DRAWCALL_OVERFLOW;
+            rlDrawRenderBatch(RLGL.currentBatch);
+        }
 
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = mode;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
@@ -1363,13 +1526,46 @@ void rlEnd(void)
     // NOTE: Depth increment is dependant on rlOrtho(): z-near and z-far values,
     // as well as depth buffer bit-depth (16bit or 24bit or 32bit)
     // Correct increment formula would be: depthInc = (zfar - znear)/pow(2, bits)
-    RLGL.currentBatch->currentDepth += (1.0f/20000.0f);
+    if (rlRecordBuffer != NULL) rlRecordBuffer->currentDepth += (1.0f/20000.0f);
+    else RLGL.currentBatch->currentDepth += (1.0f/20000.0f);
 }
 
 // Define one vertex (position)
 // NOTE: Vertex position data is the basic information required for drawing
 void rlVertex3f(float x, float y, float z)
 {
+    rlCommandBuffer *record = rlRecordBuffer;
+    if (record != NULL)
+    {
+        // NOTE: Recorded vertices are not transformed, rlSubmitCommandBuffer() applies the transform current at submit,
+        // queued draws are recorded on the main thread and could be submitted after rlPopMatrix(), they are transformed now
+        if (record->vertexCount >= record->vertexCapacity) rlReserveCommandBuffer(record, 1);
+
+        rlStreamVertex *vertex = &record->vertices[record->vertexCount];
+        if (rlIsDrawQueueBuffer(record) && RLGL.State.transformRequired)
+        {
+            vertex->position[0] = RLGL.State.transform.m0*x + RLGL.State.transform.m4*y + RLGL.State.transform.m8*z + RLGL.State.transform.m12;
+            vertex->position[1] = RLGL.State.transform.m1*x + RLGL.State.transform.m5*y + RLGL.State.transform.m9*z + RLGL.State.transform.m13;
+            vertex->position[2] = RLGL.State.transform.m2*x + RLGL.State.transform.m6*y + RLGL.State.transform.m10*z + RLGL.State.transform.m14;
+        }
+        else
+        {
+            vertex->position[0] = x;
+            vertex->position[1] = y;
+            vertex->position[2] = z;
+        }
+        vertex->texcoord[0] = record->texcoordx;
+        vertex->texcoord[1] = record->texcoordy;
+        vertex->color[0] = record->colorr;
+        vertex->color[1] = record->colorg;
+        vertex->color[2] = record->colorb;
+        vertex->color[3] = record->colora;
+
+        record->vertexCount++;
+        record->draws[record->drawCount - 1].vertexCount++;
+        return;
+    }
+
     float tx = x;
     float ty = y;
     float tz = z;
@@ -1407,23 +1603,41 @@ void rlVertex3f(float x, float y, float z)
         }
     }
 
-    // Add vertices
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter] = tx;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter + 1] = ty;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter + 2] = tz;
-
-    // Add current texcoord
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].texcoords[2*RLGL.State.vertexCounter] = RLGL.State.texcoordx;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].texcoords[2*RLGL.State.vertexCounter + 1] = RLGL.State.texcoordy;
-
-    // TODO: Add current normal
-    // By default rlVertexBuffer type does not store normals
-
-    // Add current color
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter] = RLGL.State.colorr;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 1] = RLGL.State.colorg;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 2] = RLGL.State.colorb;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 3] = RLGL.State.colora;
+    if (RLGL.currentBatch->stream == RL_BATCH_STREAM_INTERLEAVED)
+    {
+        // Add vertex position, texcoord and color in one go
+        // NOTE: When the buffer is persistently mapped this writes GPU visible memory directly
+        rlStreamVertex *vertex = &RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].streamVertices[RLGL.State.vertexCounter];
+        vertex->position[0] = tx;
+        vertex->position[1] = ty;
+        vertex->position[2] = tz;
+        vertex->texcoord[0] = RLGL.State.texcoordx;
+        vertex->texcoord[1] = RLGL.State.texcoordy;
+        vertex->color[0] = RLGL.State.colorr;
+        vertex->color[1] = RLGL.State.colorg;
+        vertex->color[2] = RLGL.State.colorb;
+        vertex->color[3] = RLGL.State.colora;
+    }
+    else
+    {
+        // Add vertices
+        RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter] = tx;
+        RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter + 1] = ty;
+        RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter + 2] = tz;
+
+        // Add current texcoord
+        RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].texcoords[2*RLGL.State.vertexCounter] = RLGL.State.texcoordx;
+        RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].texcoords[2*RLGL.State.vertexCounter + 1] = RLGL.State.texcoordy;
+
+        // TODO: Add current normal
+        // By default rlVertexBuffer type does not store normals
+
+        // Add current color
+        RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter] = RLGL.State.colorr;
+        RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 1] = RLGL.State.colorg;
+        RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 2] = RLGL.State.colorb;
+        RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 3] = RLGL.State.colora;
+    }
 
     RLGL.State.vertexCounter++;
     RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount++;
@@ -1432,19 +1646,27 @@ void rlVertex3f(float x, float y, float z)
 // Define one vertex (position)
 void rlVertex2f(float x, float y)
 {
-    rlVertex3f(x, y, RLGL.currentBatch->currentDepth);
+    rlVertex3f(x, y, (rlRecordBuffer != NULL)? rlRecordBuffer->currentDepth : RLGL.currentBatch->currentDepth);
 }
 
 // Define one vertex (position)
 void rlVertex2i(int x, int y)
 {
-    rlVertex3f((float)x, (float)y, RLGL.currentBatch->currentDepth);
+    rlVertex2f((float)x, (float)y);
 }
 
 // Define one vertex (texture coordinate)
 // NOTE: Texture coordinates are limited to QUADS only
 void rlTexCoord2f(float x, float y)
 {
+    rlCommandBuffer *record = rlRecordBuffer;
+    if (record != NULL)
+    {
+        record->texcoordx = x;
+        record->texcoordy = y;
+        return;
+    }
+
     RLGL.State.texcoordx = x;
     RLGL.State.texcoordy = y;
 }
@@ -1453,6 +1675,8 @@ void rlTexCoord2f(float x, float y)
 // NOTE: Normals limited to TRIANGLES only?
 void rlNormal3f(float x, float y, float z)
 {
+    if (rlRecordBuffer != NULL) return;     // Command buffers do not store normals
+
     RLGL.State.normalx = x;
     RLGL.State.normaly = y;
     RLGL.State.normalz = z;
@@ -1461,6 +1685,16 @@ void rlNormal3f(float x, float y, float z)
 // Define one vertex (color)
 void rlColor4ub(unsigned char x, unsigned char y, unsigned char z, unsigned char w)
 {
+    rlCommandBuffer *record = rlRecordBuffer;
+    if (record != NULL)
+    {
+        record->colorr = x;
+        record->colorg = y;
+        record->colorb = z;
+        record->colora = w;
+        return;
+    }
+
     RLGL.State.colorr = x;
     RLGL.State.colorg = y;
     RLGL.State.colorb = z;
@@ -1493,10 +1727,13 @@ void rlSetTexture(unsigned int id)
 #if defined(GRAPHICS_API_OPENGL_11)
         rlDisableTexture();
 #else
+        if (rlRecordBuffer != NULL) return;
+
         // NOTE: If quads batch limit is reached, we force a draw call and next batch starts
         if (RLGL.State.vertexCounter >=
             RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementCount*4)
         {
+            RLGL.Stats.flushReason = RL_FLUSH_VERTEX_OVERFLOW;
             rlDrawRenderBatch(RLGL.currentBatch);
         }
 #endif
@@ -1506,6 +1743,15 @@ void rlSetTexture(unsigned int id)
 #if defined(GRAPHICS_API_OPENGL_11)
         rlEnableTexture(id);
 #else
+        rlCommandBuffer *record = rlRecordBuffer;
+        if (record != NULL)
+        {
+            // NOTE: Like unused render batch draws, a new draw starts in RL_QUADS mode, an empty one keeps its mode
+            rlDrawCall *draw = &record->draws[record->drawCount - 1];
+            if (draw->textureId != id) rlRecordDraw(record, (draw->vertexCount > 0)? RL_QUADS : draw->mode, id);
+            return;
+        }
+
         if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId != id)
         {
             if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount > 0)
@@ -1524,10 +1770,15 @@ void rlSetTexture(unsigned int id)
                     RLGL.State.vertexCounter += RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexAlignment;
 
                     RLGL.currentBatch->drawCounter++;
+                    RLGL.Stats.counters.textureChanges++;
                 }
             }
 
-            if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlDrawRenderBatch(RLGL.currentBatch);
+            if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS)
+            {
+                RLGL.Stats.flushReason = RL_FLUSH_DRAWCALL_OVERFLOW;
+                rlDrawRenderBatch(RLGL.currentBatch);
+            }
 
             RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = id;
             RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
@@ -2072,7 +2323,8 @@ void rlglInit(int width, int height)
     RLGL.State.currentShaderLocs = RLGL.State.defaultShaderLocs;
 
     // Init default vertex arrays buffers
-    RLGL.defaultBatch = rlLoadRenderBatch(RL_DEFAULT_BATCH_BUFFERS, RL_DEFAULT_BATCH_BUFFER_ELEMENTS);
+    if (RLGL.defaultBatchStream == RL_BATCH_STREAM_INTERLEAVED) RLGL.defaultBatch = rlLoadRenderBatchStream(RL_DEFAULT_BATCH_STREAM_BUFFERS, RL_DEFAULT_BATCH_BUFFER_ELEMENTS, RL_BATCH_STREAM_INTERLEAVED);
+    else RLGL.defaultBatch = rlLoadRenderBatch(RL_DEFAULT_BATCH_BUFFERS, RL_DEFAULT_BATCH_BUFFER_ELEMENTS);
     RLGL.currentBatch = &RLGL.defaultBatch;
 
     // Init stack matrices (emulating OpenGL 1.1)
@@ -2133,6 +2385,13 @@ void rlglClose(void)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     rlUnloadRenderBatch(RLGL.defaultBatch);
 
+    // Unload draw queue, loaded on first rlEnableDrawQueue()
+    if (RLGL.Queue.layers[0].vertices != NULL)
+    {
+        for (int i = 0; i < RL_DEFAULT_DRAW_QUEUE_LAYERS; i++) rlUnloadCommandBuffer(RLGL.Queue.layers[i]);
+        RL_FREE(RLGL.Queue.order);
+    }
+
     rlUnloadShaderDefault();          // Unload default shader
 
     glDeleteTextures(1, &RLGL.State.defaultTextureId); // Unload default texture
@@ -2193,6 +2452,9 @@ void rlLoadExtensions(void *loader)
     RLGL.ExtSupported.computeShader = GLAD_GL_ARB_compute_shader;
     RLGL.ExtSupported.ssbo = GLAD_GL_ARB_shader_storage_buffer_object;
     #endif
+    #if !defined(GRAPHICS_API_OPENGL_21)
+    RLGL.ExtSupported.bufferStorage = GLAD_GL_ARB_buffer_storage && GLAD_GL_VERSION_3_2;   // Fences (sync objects) are core since OpenGL 3.2
+    #endif
 
 #endif  // GRAPHICS_API_OPENGL_33
 
@@ -2377,6 +2639,7 @@ void rlLoadExtensions(void *loader)
     if (RLGL.ExtSupported.texCompASTC) TRACELOG(RL_LOG_INFO, "GL: ASTC compressed textures supported");
     if (RLGL.ExtSupported.computeShader) TRACELOG(RL_LOG_INFO, "GL: Compute shaders supported");
     if (RLGL.ExtSupported.ssbo) TRACELOG(RL_LOG_INFO, "GL: Shader storage buffer objects supported");
+    if (RLGL.ExtSupported.bufferStorage) TRACELOG(RL_LOG_INFO, "GL: Persistently mapped buffers supported");
 #endif  // RLGL_SHOW_GL_DETAILS_INFO
 
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
@@ -2470,25 +2733,59 @@ int *rlGetShaderLocsDefault(void)
     return locs;
 }
 
+// Get current shader id (used by render batch)
+unsigned int rlGetShaderIdCurrent(void)
+{
+    unsigned int id = 0;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    id = RLGL.State.currentShaderId;
+#endif
+    return id;
+}
+
 // Render batch management
 //------------------------------------------------------------------------------------------------
 // Load render batch
 rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
+{
+    return rlLoadRenderBatchStream(numBuffers, bufferElements, RL_BATCH_STREAM_SEPARATE);
+}
+
+// Load render batch with a vertex streaming mode
+// NOTE: RL_BATCH_STREAM_INTERLEAVED uses every buffer as one slot of a ring: vertices are written into
+// the current slot while the GPU may still be reading the previous ones, a fence per slot tells when it can be reused
+rlRenderBatch rlLoadRenderBatchStream(int numBuffers, int bufferElements, int stream)
 {
     rlRenderBatch batch = { 0 };
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    batch.stream = stream;
+    batch.streamMapped = (stream == RL_BATCH_STREAM_INTERLEAVED) && RLGL.ExtSupported.bufferStorage;
+
     // Initialize CPU (RAM) vertex buffers (position, texcoord, color data and indexes)
     //--------------------------------------------------------------------------------------------
-    batch.vertexBuffer = (rlVertexBuffer *)RL_MALLOC(numBuffers*sizeof(rlVertexBuffer));
+    batch.vertexBuffer = (rlVertexBuffer *)RL_CALLOC(numBuffers, sizeof(rlVertexBuffer));
 
     for (int i = 0; i < numBuffers; i++)
     {
         batch.vertexBuffer[i].elementCount = bufferElements;
 
-        batch.vertexBuffer[i].vertices = (float *)RL_MALLOC(bufferElements*3*4*sizeof(float));        // 3 float by vertex, 4 vertex by quad
-        batch.vertexBuffer[i].texcoords = (float *)RL_MALLOC(bufferElements*2*4*sizeof(float));       // 2 float by texcoord, 4 texcoord by quad
-        batch.vertexBuffer[i].colors = (unsigned char *)RL_MALLOC(bufferElements*4*4*sizeof(unsigned char));   // 4 float by color, 4 colors by quad
+        if (stream == RL_BATCH_STREAM_SEPARATE)
+        {
+            batch.vertexBuffer[i].vertices = (float *)RL_MALLOC(bufferElements*3*4*sizeof(float));        // 3 float by vertex, 4 vertex by quad
+            batch.vertexBuffer[i].texcoords = (float *)RL_MALLOC(bufferElements*2*4*sizeof(float));       // 2 float by texcoord, 4 texcoord by quad
+            batch.vertexBuffer[i].colors = (unsigned char *)RL_MALLOC(bufferElements*4*4*sizeof(unsigned char));   // 4 float by color, 4 colors by quad
+
+            for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].vertices[j] = 0.0f;
+            for (int j = 0; j < (2*4*bufferElements); j++) batch.vertexBuffer[i].texcoords[j] = 0.0f;
+            for (int j = 0; j < (4*4*bufferElements); j++) batch.vertexBuffer[i].colors[j] = 0;
+        }
+        else if (!batch.streamMapped)
+        {
+            // Interleaved vertices are written here and uploaded on draw (persistent mapping not supported)
+            batch.vertexBuffer[i].streamVertices = (rlStreamVertex *)RL_CALLOC(bufferElements*4, sizeof(rlStreamVertex));
+        }
+
 #if defined(GRAPHICS_API_OPENGL_33)
         batch.vertexBuffer[i].indices = (unsigned int *)RL_MALLOC(bufferElements*6*sizeof(unsigned int));      // 6 int by quad (indices)
 #endif
@@ -2496,10 +2793,6 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         batch.vertexBuffer[i].indices = (unsigned short *)RL_MALLOC(bufferElements*6*sizeof(unsigned short));  // 6 int by quad (indices)
 #endif
 
-        for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].vertices[j] = 0.0f;
-        for (int j = 0; j < (2*4*bufferElements); j++) batch.vertexBuffer[i].texcoords[j] = 0.0f;
-        for (int j = 0; j < (4*4*bufferElements); j++) batch.vertexBuffer[i].colors[j] = 0;
-
         int k = 0;
 
         // Indices can be initialized right now
@@ -2532,27 +2825,57 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
             glBindVertexArray(batch.vertexBuffer[i].vaoId);
         }
 
-        // Quads - Vertex buffers binding and attributes enable
-        // Vertex position buffer (shader-location = 0)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].vertices, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
-
-        // Vertex texcoord buffer (shader-location = 1)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[1]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[1]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*2*4*sizeof(float), batch.vertexBuffer[i].texcoords, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
-
-        // Vertex color buffer (shader-location = 3)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[2]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[2]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*4*4*sizeof(unsigned char), batch.vertexBuffer[i].colors, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+        if (stream == RL_BATCH_STREAM_SEPARATE)
+        {
+            // Quads - Vertex buffers binding and attributes enable
+            // Vertex position buffer (shader-location = 0)
+            glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
+            glBufferData(GL_ARRAY_BUFFER, bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].vertices, GL_DYNAMIC_DRAW);
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
+
+            // Vertex texcoord buffer (shader-location = 1)
+            glGenBuffers(1, &batch.vertexBuffer[i].vboId[1]);
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[1]);
+            glBufferData(GL_ARRAY_BUFFER, bufferElements*2*4*sizeof(float), batch.vertexBuffer[i].texcoords, GL_DYNAMIC_DRAW);
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
+
+            // Vertex color buffer (shader-location = 3)
+            glGenBuffers(1, &batch.vertexBuffer[i].vboId[2]);
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[2]);
+            glBufferData(GL_ARRAY_BUFFER, bufferElements*4*4*sizeof(unsigned char), batch.vertexBuffer[i].colors, GL_DYNAMIC_DRAW);
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+        }
+        else
+        {
+            // Interleaved vertex buffer (position, texcoord and color), vboId[1] and vboId[2] are not used
+            int size = bufferElements*4*sizeof(rlStreamVertex);
+
+            glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
+
+#if defined(GRAPHICS_API_OPENGL_33)
+            if (batch.streamMapped)
+            {
+                // Immutable storage mapped once for the batch lifetime, coherent so no flush is required before drawing
+                GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+                glBufferStorage(GL_ARRAY_BUFFER, size, NULL, flags);
+                batch.vertexBuffer[i].streamVertices = (rlStreamVertex *)glMapBufferRange(GL_ARRAY_BUFFER, 0, size, flags);
+            }
+            else glBufferData(GL_ARRAY_BUFFER, size, NULL, GL_STREAM_DRAW);
+#else
+            glBufferData(GL_ARRAY_BUFFER, size, NULL, GL_STREAM_DRAW);
+#endif
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, sizeof(rlStreamVertex), (void *)0);
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, sizeof(rlStreamVertex), (void *)(3*sizeof(float)));
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(rlStreamVertex), (void *)(5*sizeof(float)));
+        }
 
         // Fill index buffer
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[3]);
@@ -2566,6 +2889,11 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
     }
 
     TRACELOG(RL_LOG_INFO, "RLGL: Render batch vertex buffers loaded successfully in VRAM (GPU)");
+    if (stream == RL_BATCH_STREAM_INTERLEAVED)
+    {
+        if (batch.streamMapped) TRACELOG(RL_LOG_INFO, "RLGL: Render batch streaming interleaved vertices through %i persistently mapped buffers", numBuffers);
+        else TRACELOG(RL_LOG_INFO, "RLGL: Render batch streaming interleaved vertices through %i orphaned buffers (persistent mapping not supported)", numBuffers);
+    }
 
     // Unbind the current VAO
     if (RLGL.ExtSupported.vao) glBindVertexArray(0);
@@ -2618,6 +2946,18 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
             glBindVertexArray(0);
         }
 
+#if defined(GRAPHICS_API_OPENGL_33)
+        // Release stream fence and mapping, the mapped pointer is not owned by us
+        if (batch.vertexBuffer[i].fence != NULL) glDeleteSync((GLsync)batch.vertexBuffer[i].fence);
+        if (batch.streamMapped)
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
+            glUnmapBuffer(GL_ARRAY_BUFFER);
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+            batch.vertexBuffer[i].streamVertices = NULL;
+        }
+#endif
+
         // Delete VBOs from GPU (VRAM)
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[0]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[1]);
@@ -2631,6 +2971,7 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
         RL_FREE(batch.vertexBuffer[i].vertices);
         RL_FREE(batch.vertexBuffer[i].texcoords);
         RL_FREE(batch.vertexBuffer[i].colors);
+        RL_FREE(batch.vertexBuffer[i].streamVertices);
         RL_FREE(batch.vertexBuffer[i].indices);
     }
 
@@ -2645,29 +2986,59 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
 void rlDrawRenderBatch(rlRenderBatch *batch)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Every flush of the active batch is a draw queue barrier, queued draws go first
+    if (RLGL.Queue.active && !RLGL.Queue.flushing && (batch == RLGL.currentBatch)) rlFlushDrawQueue();
+
+    PROFILE_BEGIN("rlDrawRenderBatch");
+
     // Update batch vertex buffers
     //------------------------------------------------------------------------------------------------------------
     // NOTE: If there is not vertex data, buffers doesn't need to be updated (vertexCount > 0)
     // TODO: If no data changed on the CPU arrays --> No need to re-update GPU arrays (change flag required)
     if (RLGL.State.vertexCounter > 0)
     {
-        // Activate elements VAO
-        if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
+        RLGL.Stats.counters.flushes++;
+        if (RLGL.Stats.flushReason == RL_FLUSH_VERTEX_OVERFLOW) RLGL.Stats.counters.vertexOverflows++;
+        else if (RLGL.Stats.flushReason == RL_FLUSH_DRAWCALL_OVERFLOW) RLGL.Stats.counters.drawCallOverflows++;
+        else RLGL.Stats.counters.stateFlushes++;
 
-        // Vertex positions buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*3*sizeof(float), batch->vertexBuffer[batch->currentBuffer].vertices);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].vertices, GL_DYNAMIC_DRAW);  // Update all buffer
+        for (int i = 0; i < batch->drawCounter; i++) RLGL.Stats.counters.vertices += batch->draws[i].vertexCount;
 
-        // Texture coordinates buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*2*sizeof(float), batch->vertexBuffer[batch->currentBuffer].texcoords);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].texcoords, GL_DYNAMIC_DRAW); // Update all buffer
+        // NOTE: Persistently mapped buffers are not uploaded here but the same bytes were written to GPU memory
+        if (batch->stream == RL_BATCH_STREAM_INTERLEAVED) RLGL.Stats.counters.bytesUploaded += RLGL.State.vertexCounter*sizeof(rlStreamVertex);
+        else RLGL.Stats.counters.bytesUploaded += RLGL.State.vertexCounter*(3*sizeof(float) + 2*sizeof(float) + 4*sizeof(unsigned char));
 
-        // Colors buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*4*sizeof(unsigned char), batch->vertexBuffer[batch->currentBuffer].colors);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].colors, GL_DYNAMIC_DRAW);    // Update all buffer
+        // Activate elements VAO
+        if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
+
+        if (batch->stream == RL_BATCH_STREAM_INTERLEAVED)
+        {
+            // Persistently mapped buffers already hold the vertices, orphaned ones get the whole batch in one upload:
+            // orphaning hands the driver a fresh storage so the upload never waits for draws still reading the old one
+            if (!batch->streamMapped)
+            {
+                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
+                glBufferData(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].elementCount*4*sizeof(rlStreamVertex), NULL, GL_STREAM_DRAW);
+                glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*sizeof(rlStreamVertex), batch->vertexBuffer[batch->currentBuffer].streamVertices);
+            }
+        }
+        else
+        {
+            // Vertex positions buffer
+            glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*3*sizeof(float), batch->vertexBuffer[batch->currentBuffer].vertices);
+            //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].vertices, GL_DYNAMIC_DRAW);  // Update all buffer
+
+            // Texture coordinates buffer
+            glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*2*sizeof(float), batch->vertexBuffer[batch->currentBuffer].texcoords);
+            //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].texcoords, GL_DYNAMIC_DRAW); // Update all buffer
+
+            // Colors buffer
+            glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*4*sizeof(unsigned char), batch->vertexBuffer[batch->currentBuffer].colors);
+            //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].colors, GL_DYNAMIC_DRAW);    // Update all buffer
+        }
 
         // NOTE: glMapBuffer() causes sync issue.
         // If GPU is working with this buffer, glMapBuffer() will wait(stall) until GPU to finish its job.
@@ -2727,6 +3098,19 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
             glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MVP], 1, false, matMVPfloat);
 
             if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
+            else if (batch->stream == RL_BATCH_STREAM_INTERLEAVED)
+            {
+                // Bind vertex attribs from the interleaved buffer: position, texcoord and color
+                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
+                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, sizeof(rlStreamVertex), (void *)0);
+                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
+                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, sizeof(rlStreamVertex), (void *)(3*sizeof(float)));
+                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(rlStreamVertex), (void *)(5*sizeof(float)));
+                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+
+                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
+            }
             else
             {
                 // Bind vertex attrib: position (shader-location = 0)
@@ -2770,6 +3154,7 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
             {
                 // Bind current draw call texture, activated as GL_TEXTURE0 and Bound to sampler2D texture0 by default
                 glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
+                RLGL.Stats.counters.drawCalls++;
 
                 if ((batch->draws[i].mode == RL_LINES) || (batch->draws[i].mode == RL_TRIANGLES)) glDrawArrays(batch->draws[i].mode, vertexOffset, batch->draws[i].vertexCount);
                 else
@@ -2804,6 +3189,15 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
 
     // Restore viewport to default measures
     if (eyeCount == 2) rlViewport(0, 0, RLGL.State.framebufferWidth, RLGL.State.framebufferHeight);
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    // Mark when the GPU is done reading this mapped buffer, it is not written again before that
+    if (batch->streamMapped && (RLGL.State.vertexCounter > 0))
+    {
+        if (batch->vertexBuffer[batch->currentBuffer].fence != NULL) glDeleteSync((GLsync)batch->vertexBuffer[batch->currentBuffer].fence);
+        batch->vertexBuffer[batch->currentBuffer].fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+#endif
     //------------------------------------------------------------------------------------------------------------
 
     // Reset batch buffers
@@ -2831,11 +3225,45 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
 
     // Reset draws counter to one draw for the batch
     batch->drawCounter = 1;
+
+    // Next flush is a state flush unless an overflow check says otherwise
+    RLGL.Stats.flushReason = RL_FLUSH_STATE;
     //------------------------------------------------------------------------------------------------------------
 
     // Change to next buffer in the list (in case of multi-buffering)
     batch->currentBuffer++;
     if (batch->currentBuffer >= batch->bufferCount) batch->currentBuffer = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    // Next mapped buffer could still be read by the GPU (ring wrapped around), wait before writing it
+    // NOTE: With enough buffers in the ring the fence is already signaled and this returns at once
+    if (batch->streamMapped && (batch->vertexBuffer[batch->currentBuffer].fence != NULL))
+    {
+        GLsync fence = (GLsync)batch->vertexBuffer[batch->currentBuffer].fence;
+        GLenum result = glClientWaitSync(fence, 0, 0);
+
+        if (result == GL_TIMEOUT_EXPIRED)
+        {
+            PROFILE_BEGIN("rlWaitStreamBuffer");
+            while (result == GL_TIMEOUT_EXPIRED) result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);  // Wait in 1 ms steps
+            PROFILE_END();
+        }
+
+        glDeleteSync(fence);
+        batch->vertexBuffer[batch->currentBuffer].fence = NULL;
+    }
+#endif
+
+    PROFILE_END();
+#endif
+}
+
+// Set default render batch vertex streaming mode
+// NOTE: Applied when the default batch is loaded, call it before rlglInit()
+void rlSetDefaultBatchStream(int stream)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.defaultBatchStream = stream;
 #endif
 }
 
@@ -2865,6 +3293,13 @@ bool rlCheckRenderBatchLimit(int vCount)
     bool overflow = false;
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (rlRecordBuffer != NULL)
+    {
+        // Command buffers grow instead, they never overflow
+        rlReserveCommandBuffer(rlRecordBuffer, vCount);
+        return overflow;
+    }
+
     if ((RLGL.State.vertexCounter + vCount) >=
         (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementCount*4))
     {
@@ -2874,6 +3309,7 @@ bool rlCheckRenderBatchLimit(int vCount)
         int currentMode = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode;
         int currentTexture = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId;
 
+        RLGL.Stats.flushReason = RL_FLUSH_VERTEX_OVERFLOW;
         rlDrawRenderBatch(RLGL.currentBatch);    // NOTE: Stereo rendering is checked inside
 
         // Restore state of last batch so we can continue adding vertices
@@ -2885,6 +3321,335 @@ bool rlCheckRenderBatchLimit(int vCount)
     return overflow;
 }
 
+// Get render batch statistics accumulated since last reset
+rlBatchStats rlGetBatchStats(void)
+{
+    rlBatchStats stats = { 0 };
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    stats = RLGL.Stats.counters;
+#endif
+
+    return stats;
+}
+
+// Reset render batch statistics
+void rlResetBatchStats(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlBatchStats stats = { 0 };
+    RLGL.Stats.counters = stats;
+#endif
+}
+
+// Command buffers management
+//-----------------------------------------------------------------------------------------
+// Load a command buffer with an initial vertex capacity
+// NOTE: Buffers grow while recording, keep them loaded across frames to reuse the memory
+rlCommandBuffer rlLoadCommandBuffer(int vertexCount)
+{
+    rlCommandBuffer buffer = { 0 };
+
+    buffer.vertexCapacity = (vertexCount > 4)? vertexCount : 4;
+    buffer.vertices = (rlStreamVertex *)RL_MALLOC(buffer.vertexCapacity*sizeof(rlStreamVertex));
+    buffer.drawCapacity = 32;
+    buffer.draws = (rlDrawCall *)RL_CALLOC(buffer.drawCapacity, sizeof(rlDrawCall));
+
+    return buffer;
+}
+
+// Unload command buffer
+void rlUnloadCommandBuffer(rlCommandBuffer buffer)
+{
+    RL_FREE(buffer.vertices);
+    RL_FREE(buffer.draws);
+}
+
+// Begin recording on the calling thread, previous commands are cleared
+// NOTE: Only rlgl vertex functions are recorded, matrix stack, shader and render state
+// functions (and raylib functions using them) must still be called on the main thread,
+// SHAPES_MODE_SDF shapes are recorded tessellated
+void rlBeginCommandBuffer(rlCommandBuffer *buffer)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlResetCommandBuffer(buffer);
+
+    // NOTE: Draw queue recording on main thread is suspended until rlEndCommandBuffer()
+    rlRecordSuspended = rlRecordBuffer;
+    rlRecordBuffer = buffer;
+#else
+    TRACELOG(RL_LOG_WARNING, "RLGL: Command buffers not supported on OpenGL 1.1, drawing immediately");
+#endif
+}
+
+// End recording on the calling thread
+void rlEndCommandBuffer(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlRecordBuffer = rlRecordSuspended;
+    rlRecordSuspended = NULL;
+#endif
+}
+
+// Append recorded commands to the active render batch
+// NOTE: Must be called on the main thread once recording has ended, the current transform
+// (rlPushMatrix()/rlTranslatef()...) is applied to the vertices like on immediate drawing
+void rlSubmitCommandBuffer(const rlCommandBuffer *buffer)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    PROFILE_BEGIN("rlSubmitCommandBuffer");
+
+    const rlStreamVertex *vertices = buffer->vertices;
+
+    for (int i = 0; i < buffer->drawCount; i++)
+    {
+        if (buffer->draws[i].vertexCount > 0) rlSubmitRecordedDraw(&buffer->draws[i], vertices, true);
+
+        vertices += buffer->draws[i].vertexCount;
+    }
+
+    PROFILE_END();
+#endif
+}
+
+// Check if the calling thread is recording a command buffer
+// NOTE: Draw queue does not count, queued draws are submitted under the same view
+bool rlIsCommandBufferRecording(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    return ((rlRecordBuffer != NULL) && !rlIsDrawQueueBuffer(rlRecordBuffer));
+#else
+    return false;
+#endif
+}
+
+// Static layers management
+//-----------------------------------------------------------------------------------------
+// Load static layer from recorded commands, vertices are uploaded once to a static buffer
+rlStaticLayer rlLoadStaticLayer(const rlCommandBuffer *buffer)
+{
+    rlStaticLayer layer = { 0 };
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Quads are split in two triangles, like the render batch does through its index buffer
+    int vertexCount = 0;
+    for (int i = 0; i < buffer->drawCount; i++) vertexCount += (buffer->draws[i].mode == RL_QUADS)? buffer->draws[i].vertexCount/4*6 : buffer->draws[i].vertexCount;
+
+    if (vertexCount > 0)
+    {
+        rlStreamVertex *vertices = (rlStreamVertex *)RL_MALLOC(vertexCount*sizeof(rlStreamVertex));
+        layer.draws = (rlDrawCall *)RL_CALLOC(buffer->drawCount, sizeof(rlDrawCall));
+
+        const rlStreamVertex *source = buffer->vertices;
+
+        for (int i = 0; i < buffer->drawCount; i++)
+        {
+            const rlDrawCall *draw = &buffer->draws[i];
+            int mode = (draw->mode == RL_QUADS)? RL_TRIANGLES : draw->mode;
+
+            if (draw->vertexCount > 0)
+            {
+                // Consecutive draws with same mode and texture are merged in one
+                if ((layer.drawCount == 0) || (layer.draws[layer.drawCount - 1].mode != mode) ||
+                    (layer.draws[layer.drawCount - 1].textureId != draw->textureId))
+                {
+                    layer.draws[layer.drawCount].mode = mode;
+                    layer.draws[layer.drawCount].textureId = draw->textureId;
+                    layer.drawCount++;
+                }
+
+                int start = layer.vertexCount;
+
+                if (draw->mode == RL_QUADS)
+                {
+                    for (int q = 0; q + 3 < draw->vertexCount; q += 4)
+                    {
+                        vertices[layer.vertexCount++] = source[q];
+                        vertices[layer.vertexCount++] = source[q + 1];
+                        vertices[layer.vertexCount++] = source[q + 2];
+                        vertices[layer.vertexCount++] = source[q];
+                        vertices[layer.vertexCount++] = source[q + 2];
+                        vertices[layer.vertexCount++] = source[q + 3];
+                    }
+                }
+                else
+                {
+                    memcpy(&vertices[layer.vertexCount], source, draw->vertexCount*sizeof(rlStreamVertex));
+                    layer.vertexCount += draw->vertexCount;
+                }
+
+                layer.draws[layer.drawCount - 1].vertexCount += (layer.vertexCount - start);
+            }
+
+            source += draw->vertexCount;
+        }
+
+        if (RLGL.ExtSupported.vao)
+        {
+            glGenVertexArrays(1, &layer.vaoId);
+            glBindVertexArray(layer.vaoId);
+        }
+
+        glGenBuffers(1, &layer.vboId);
+        glBindBuffer(GL_ARRAY_BUFFER, layer.vboId);
+        glBufferData(GL_ARRAY_BUFFER, layer.vertexCount*sizeof(rlStreamVertex), vertices, GL_STATIC_DRAW);
+        RLGL.Stats.counters.bytesUploaded += layer.vertexCount*sizeof(rlStreamVertex);
+
+        if (RLGL.ExtSupported.vao)
+        {
+            // NOTE: Attribute locations of current shader are stored in the VAO, like for the render batch
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, sizeof(rlStreamVertex), (void *)0);
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, sizeof(rlStreamVertex), (void *)(3*sizeof(float)));
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(rlStreamVertex), (void *)(5*sizeof(float)));
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+
+            glBindVertexArray(0);
+        }
+
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+        RL_FREE(vertices);
+
+        TRACELOG(RL_LOG_DEBUG, "RLGL: Static layer loaded in VRAM (GPU) [VBO ID %i] (%i vertices, %i draws)", layer.vboId, layer.vertexCount, layer.drawCount);
+    }
+#else
+    TRACELOG(RL_LOG_WARNING, "RLGL: Static layers not supported on OpenGL 1.1");
+#endif
+
+    return layer;
+}
+
+// Unload static layer from GPU memory
+void rlUnloadStaticLayer(rlStaticLayer layer)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (layer.vaoId > 0) glDeleteVertexArrays(1, &layer.vaoId);
+    if (layer.vboId > 0) glDeleteBuffers(1, &layer.vboId);
+#endif
+    RL_FREE(layer.draws);
+}
+
+// Draw static layer with current shader, one draw call per layer draw
+// NOTE: Render batch is drawn first to keep drawing order, the accumulated transform
+// (rlPushMatrix()/rlTranslatef()...) is applied after the provided one
+void rlDrawStaticLayer(const rlStaticLayer *layer, Matrix transform)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (layer->vertexCount > 0)
+    {
+        rlDrawRenderBatch(RLGL.currentBatch);
+
+        Matrix matModel = transform;
+        if (RLGL.State.transformRequired) matModel = rlMatrixMultiply(transform, RLGL.State.transform);
+
+        Matrix matMVP = rlMatrixMultiply(rlMatrixMultiply(matModel, RLGL.State.modelview), RLGL.State.projection);
+        float matMVPfloat[16] = {
+            matMVP.m0, matMVP.m1, matMVP.m2, matMVP.m3,
+            matMVP.m4, matMVP.m5, matMVP.m6, matMVP.m7,
+            matMVP.m8, matMVP.m9, matMVP.m10, matMVP.m11,
+            matMVP.m12, matMVP.m13, matMVP.m14, matMVP.m15
+        };
+
+        glUseProgram(RLGL.State.currentShaderId);
+        glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MVP], 1, false, matMVPfloat);
+        glUniform4f(RLGL.State.currentShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE], 1.0f, 1.0f, 1.0f, 1.0f);
+        glUniform1i(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE], 0);
+
+        if (RLGL.ExtSupported.vao) glBindVertexArray(layer->vaoId);
+        else
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, layer->vboId);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, sizeof(rlStreamVertex), (void *)0);
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, sizeof(rlStreamVertex), (void *)(3*sizeof(float)));
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(rlStreamVertex), (void *)(5*sizeof(float)));
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+        }
+
+        glActiveTexture(GL_TEXTURE0);
+
+        for (int i = 0, vertexOffset = 0; i < layer->drawCount; i++)
+        {
+            glBindTexture(GL_TEXTURE_2D, layer->draws[i].textureId);
+            glDrawArrays(layer->draws[i].mode, vertexOffset, layer->draws[i].vertexCount);
+            RLGL.Stats.counters.drawCalls++;
+
+            vertexOffset += layer->draws[i].vertexCount;
+        }
+
+        glBindTexture(GL_TEXTURE_2D, 0);
+
+        if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+        else glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+        glUseProgram(0);
+    }
+#endif
+}
+
+// Draw queue management
+//-----------------------------------------------------------------------------------------
+// Enable draw queue, next batch draws on the main thread are deferred
+void rlEnableDrawQueue(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!RLGL.Queue.active)
+    {
+        if (RLGL.Queue.layers[0].vertices == NULL)
+        {
+            for (int i = 0; i < RL_DEFAULT_DRAW_QUEUE_LAYERS; i++) RLGL.Queue.layers[i] = rlLoadCommandBuffer(1024);
+
+            RLGL.Queue.orderCapacity = 256;
+            RLGL.Queue.order = (rlQueuedDraw *)RL_MALLOC(RLGL.Queue.orderCapacity*sizeof(rlQueuedDraw));
+        }
+
+        for (int i = 0; i < RL_DEFAULT_DRAW_QUEUE_LAYERS; i++) rlResetCommandBuffer(&RLGL.Queue.layers[i]);
+
+        // Previous draws keep their place
+        rlDrawRenderBatch(RLGL.currentBatch);
+
+        RLGL.Queue.active = true;
+        if (rlRecordBuffer == NULL) rlRecordBuffer = &RLGL.Queue.layers[RLGL.Queue.layer];
+    }
+#else
+    TRACELOG(RL_LOG_WARNING, "RLGL: Draw queue not supported on OpenGL 1.1, drawing immediately");
+#endif
+}
+
+// Disable draw queue, queued draws are submitted to the render batch
+void rlDisableDrawQueue(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.Queue.active)
+    {
+        rlFlushDrawQueue();
+
+        if (rlIsDrawQueueBuffer(rlRecordBuffer)) rlRecordBuffer = NULL;
+        RLGL.Queue.active = false;
+    }
+#endif
+}
+
+// Set layer for next queued draws, layers are drawn in increasing order
+void rlSetDrawLayer(int layer)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (layer < 0) layer = 0;
+    else if (layer >= RL_DEFAULT_DRAW_QUEUE_LAYERS) layer = RL_DEFAULT_DRAW_QUEUE_LAYERS - 1;
+
+    RLGL.Queue.layer = layer;
+
+    if (RLGL.Queue.active)
+    {
+        if (rlIsDrawQueueBuffer(rlRecordBuffer)) rlRecordBuffer = &RLGL.Queue.layers[layer];
+        else if (rlIsDrawQueueBuffer(rlRecordSuspended)) rlRecordSuspended = &RLGL.Queue.layers[layer];
+    }
+#endif
+}
+
 // Textures data management
 //-----------------------------------------------------------------------------------------
 // Convert image data to OpenGL texture (returns OpenGL valid Id)
@@ -3556,6 +4321,17 @@ void rlUpdateVertexBuffer(unsigned int id, const void *data, int dataSize, int o
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glBindBuffer(GL_ARRAY_BUFFER, id);
     glBufferSubData(GL_ARRAY_BUFFER, offset, dataSize, data);
+    RLGL.Stats.counters.bytesUploaded += dataSize;
+#endif
+}
+
+// Orphan vertex buffer storage, next update does not wait for draws using the old one
+// NOTE: The driver keeps the old storage alive for pending draws, new storage content is undefined
+void rlOrphanVertexBuffer(unsigned int id, int size)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glBindBuffer(GL_ARRAY_BUFFER, id);
+    glBufferData(GL_ARRAY_BUFFER, size, NULL, GL_STREAM_DRAW);
 #endif
 }
 
@@ -3566,6 +4342,7 @@ void rlUpdateVertexBufferElements(unsigned int id, const void *data, int dataSiz
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
     glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, offset, dataSize, data);
+    RLGL.Stats.counters.bytesUploaded += dataSize;
 #endif
 }
 
@@ -3611,12 +4388,20 @@ void rlDisableVertexAttribute(unsigned int index)
 void rlDrawVertexArray(int offset, int count)
 {
     glDrawArrays(GL_TRIANGLES, offset, count);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.Stats.counters.drawCalls++;
+    RLGL.Stats.counters.vertices += count;
+#endif
 }
 
 // Draw vertex array elements
 void rlDrawVertexArrayElements(int offset, int count, const void *buffer)
 {
     glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (const unsigned short *)buffer + offset);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.Stats.counters.drawCalls++;
+    RLGL.Stats.counters.vertices += count;
+#endif
 }
 
 // Draw vertex array instanced
@@ -3624,6 +4409,8 @@ void rlDrawVertexArrayInstanced(int offset, int count, int instances)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glDrawArraysInstanced(GL_TRIANGLES, 0, count, instances);
+    RLGL.Stats.counters.drawCalls++;
+    RLGL.Stats.counters.vertices += count*instances;
 #endif
 }
 
@@ -3632,6 +4419,8 @@ void rlDrawVertexArrayElementsInstanced(int offset, int count, const void *buffe
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glDrawElementsInstanced(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (const unsigned short *)buffer + offset, instances);
+    RLGL.Stats.counters.drawCalls++;
+    RLGL.Stats.counters.vertices += count*instances;
 #endif
 }
 
@@ -4240,6 +5029,16 @@ Matrix rlGetMatrixTransform(void)
     return mat;
 }
 
+// Check if vertices are transformed on rlVertex*() by the accumulated transform matrix
+bool rlIsTransformRequired(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    return RLGL.State.transformRequired;
+#else
+    return false;
+#endif
+}
+
 // Get internal projection matrix for stereo render (selected eye)
 RLAPI Matrix rlGetMatrixProjectionStereo(int eye)
 {
@@ -4572,6 +5371,188 @@ static void rlUnloadShaderDefault(void)
     TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Default shader unloaded successfully", RLGL.State.defaultShaderId);
 }
 
+// Start a new recorded draw if current one has vertices, else reuse it
+static void rlRecordDraw(rlCommandBuffer *buffer, int mode, unsigned int textureId)
+{
+    rlDrawCall *draw = &buffer->draws[buffer->drawCount - 1];
+
+    if (draw->vertexCount > 0)
+    {
+        if (buffer->drawCount >= buffer->drawCapacity)
+        {
+            buffer->drawCapacity *= 2;
+            buffer->draws = (rlDrawCall *)RL_REALLOC(buffer->draws, buffer->drawCapacity*sizeof(rlDrawCall));
+        }
+
+        draw = &buffer->draws[buffer->drawCount];
+        draw->vertexCount = 0;
+        draw->vertexAlignment = 0;
+        buffer->drawCount++;
+    }
+
+    draw->mode = mode;
+    draw->textureId = textureId;
+}
+
+// Grow recorded vertices capacity to fit the given number of new vertices
+static void rlReserveCommandBuffer(rlCommandBuffer *buffer, int vertexCount)
+{
+    if ((buffer->vertexCount + vertexCount) <= buffer->vertexCapacity) return;
+
+    while ((buffer->vertexCount + vertexCount) > buffer->vertexCapacity) buffer->vertexCapacity *= 2;
+    buffer->vertices = (rlStreamVertex *)RL_REALLOC(buffer->vertices, buffer->vertexCapacity*sizeof(rlStreamVertex));
+}
+
+// Clear recorded commands and recording state
+static void rlResetCommandBuffer(rlCommandBuffer *buffer)
+{
+    buffer->vertexCount = 0;
+    buffer->drawCount = 1;
+    buffer->draws[0].mode = RL_QUADS;
+    buffer->draws[0].vertexCount = 0;
+    buffer->draws[0].vertexAlignment = 0;
+    buffer->draws[0].textureId = RLGL.State.defaultTextureId;
+    buffer->currentDepth = -1.0f;
+    buffer->texcoordx = 0.0f;
+    buffer->texcoordy = 0.0f;
+    buffer->colorr = 255;
+    buffer->colorg = 255;
+    buffer->colorb = 255;
+    buffer->colora = 255;
+}
+
+// Append one recorded draw to the active render batch
+// NOTE: With transform, the current transform (rlPushMatrix()/rlTranslatef()...) is applied like on immediate drawing
+static void rlSubmitRecordedDraw(const rlDrawCall *draw, const rlStreamVertex *vertices, bool transform)
+{
+    rlBegin(draw->mode);
+    rlSetTexture(draw->textureId);
+
+    // NOTE: rlSetTexture() could draw the batch when out of draw calls, resetting the mode,
+    // current draw has no vertices at that point so mode can be restored safely
+    if (rlRecordBuffer == NULL) RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = draw->mode;
+
+    if ((transform && RLGL.State.transformRequired) || (rlRecordBuffer != NULL))
+    {
+        // Transformed vertices go through the regular path, batch limits are checked there,
+        // so do vertices submitted on the main thread while the draw queue records them
+        for (int v = 0; v < draw->vertexCount; v++)
+        {
+            rlTexCoord2f(vertices[v].texcoord[0], vertices[v].texcoord[1]);
+            rlColor4ub(vertices[v].color[0], vertices[v].color[1], vertices[v].color[2], vertices[v].color[3]);
+            rlVertex3f(vertices[v].position[0], vertices[v].position[1], vertices[v].position[2]);
+        }
+    }
+    else
+    {
+        // Copy whole primitives while they fit in the current vertex buffer, draw the batch when it gets full
+        int primitiveSize = (draw->mode == RL_LINES)? 2 : ((draw->mode == RL_TRIANGLES)? 3 : 4);
+        int copied = 0;
+
+        while (copied < draw->vertexCount)
+        {
+            rlVertexBuffer *vertexBuffer = &RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer];
+            int count = vertexBuffer->elementCount*4 - RLGL.State.vertexCounter;
+            count -= count%primitiveSize;
+            if (count > (draw->vertexCount - copied)) count = draw->vertexCount - copied;
+
+            if (count <= 0)
+            {
+                rlCheckRenderBatchLimit(primitiveSize + 1);
+                continue;
+            }
+
+            const rlStreamVertex *source = &vertices[copied];
+            int index = RLGL.State.vertexCounter;
+
+            if (RLGL.currentBatch->stream == RL_BATCH_STREAM_INTERLEAVED) memcpy(&vertexBuffer->streamVertices[index], source, count*sizeof(rlStreamVertex));
+            else
+            {
+                for (int v = 0; v < count; v++, index++)
+                {
+                    memcpy(&vertexBuffer->vertices[3*index], source[v].position, 3*sizeof(float));
+                    memcpy(&vertexBuffer->texcoords[2*index], source[v].texcoord, 2*sizeof(float));
+                    memcpy(&vertexBuffer->colors[4*index], source[v].color, 4);
+                }
+            }
+
+            RLGL.State.vertexCounter += count;
+            RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount += count;
+            copied += count;
+        }
+    }
+}
+
+// Check if a command buffer is one of the draw queue layers
+static bool rlIsDrawQueueBuffer(const rlCommandBuffer *buffer)
+{
+    return ((buffer != NULL) && (buffer >= &RLGL.Queue.layers[0]) && (buffer < &RLGL.Queue.layers[RL_DEFAULT_DRAW_QUEUE_LAYERS]));
+}
+
+// Sort and submit queued draws to the active render batch, layer by layer
+// NOTE: Consecutive draws sharing texture and mode end up in the same batch draw call
+static void rlFlushDrawQueue(void)
+{
+    PROFILE_BEGIN("rlFlushDrawQueue");
+
+    // Recording stops while submitting, render batch overflows draw the batch as usual
+    rlCommandBuffer *recording = rlRecordBuffer;
+    rlRecordBuffer = NULL;
+    RLGL.Queue.flushing = true;
+
+    for (int l = 0; l < RL_DEFAULT_DRAW_QUEUE_LAYERS; l++)
+    {
+        rlCommandBuffer *buffer = &RLGL.Queue.layers[l];
+
+        if (buffer->vertexCount > 0)
+        {
+            if (buffer->drawCount > RLGL.Queue.orderCapacity)
+            {
+                RLGL.Queue.orderCapacity = buffer->drawCount;
+                RLGL.Queue.order = (rlQueuedDraw *)RL_REALLOC(RLGL.Queue.order, RLGL.Queue.orderCapacity*sizeof(rlQueuedDraw));
+            }
+
+            int count = 0;
+            for (int i = 0, vertexOffset = 0; i < buffer->drawCount; i++)
+            {
+                if (buffer->draws[i].vertexCount > 0)
+                {
+                    RLGL.Queue.order[count].draw = &buffer->draws[i];
+                    RLGL.Queue.order[count].vertexOffset = vertexOffset;
+                    RLGL.Queue.order[count].index = i;
+                    count++;
+                }
+
+                vertexOffset += buffer->draws[i].vertexCount;
+            }
+
+            qsort(RLGL.Queue.order, count, sizeof(rlQueuedDraw), rlCompareQueuedDraws);
+
+            // NOTE: Queued vertices were already transformed when recorded
+            for (int i = 0; i < count; i++) rlSubmitRecordedDraw(RLGL.Queue.order[i].draw, &buffer->vertices[RLGL.Queue.order[i].vertexOffset], false);
+        }
+
+        rlResetCommandBuffer(buffer);
+    }
+
+    RLGL.Queue.flushing = false;
+    rlRecordBuffer = recording;
+
+    PROFILE_END();
+}
+
+// Compare queued draws by texture, mode and recording order
+static int rlCompareQueuedDraws(const void *a, const void *b)
+{
+    const rlQueuedDraw *drawA = (const rlQueuedDraw *)a;
+    const rlQueuedDraw *drawB = (const rlQueuedDraw *)b;
+
+    if (drawA->draw->textureId != drawB->draw->textureId) return (drawA->draw->textureId < drawB->draw->textureId)? -1 : 1;
+    if (drawA->draw->mode != drawB->draw->mode) return (drawA->draw->mode < drawB->draw->mode)? -1 : 1;
+
+    return (drawA->index - drawB->index);
+}
+
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
 // Get compressed format official GL identifier name
 static char *rlGetCompressedFormatName(int format)
@@ -23,6 +23,10 @@
 *   #define SUPPORT_QUADS_DRAW_MODE
 *       Use QUADS instead of TRIANGLES for drawing when possible. Lines-based shapes still use LINES
 *
+*   NOTE: With SetShapesMode(SHAPES_MODE_SDF), full circles, rings, circle outlines and rounded
+*   rectangles are drawn as quads shaded by a signed distance shader (constant vertex count, analytic
+*   antialiasing). Shape parameters are passed in vertex z, so those shapes are meant for 2D drawing.
+*
 *
 *   LICENSE: zlib/libpng
 *
@@ -56,9 +60,14 @@
 
 #include "rlgl.h"       // OpenGL abstraction layer to OpenGL 1.1, 2.1, 3.3+ or ES2
 
-#include <math.h>       // Required for: sinf(), asinf(), cosf(), acosf(), sqrtf(), fabsf()
+#include <math.h>       // Required for: sinf(), asinf(), cosf(), acosf(), sqrtf(), fabsf(), fminf(), fmaxf()
 #include <float.h>      // Required for: FLT_EPSILON
 #include <stdlib.h>     // Required for: RL_FREE
+#include <string.h>     // Required for: memcpy()
+
+#if defined(_MSC_VER)
+    #include <intrin.h> // Required for: _InterlockedExchange()
+#endif
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
@@ -71,12 +80,35 @@
 #ifndef BEZIER_LINE_DIVISIONS
     #define BEZIER_LINE_DIVISIONS       24      // Bezier line divisions
 #endif
+#ifndef MAX_CIRCLE_SEGMENTS
+    #define MAX_CIRCLE_SEGMENTS       1024      // Maximum segments per circle/arc, larger values are clamped
+#endif
+#ifndef MAX_CIRCLE_TABLES
+    #define MAX_CIRCLE_TABLES           16      // Unit circle tables cached, one per segments/arc pair
+#endif
 
+// NOTE: Shapes can be recorded into command buffers from any thread, the circle tables cache is shared
+// behind a spin lock (held only to look up, pin and unpin a table) and the smooth segments cache is per thread
+#if defined(_MSC_VER)
+    #define SHAPES_THREAD_LOCAL __declspec(thread)
+    #define SHAPES_LOCK(lock) while (_InterlockedExchange((volatile long *)(lock), 1) != 0) { }
+    #define SHAPES_UNLOCK(lock) _InterlockedExchange((volatile long *)(lock), 0)
+#else
+    #define SHAPES_THREAD_LOCAL __thread
+    #define SHAPES_LOCK(lock) while (__atomic_exchange_n((lock), 1, __ATOMIC_ACQUIRE) != 0) { }
+    #define SHAPES_UNLOCK(lock) __atomic_store_n((lock), 0, __ATOMIC_RELEASE)
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// Not here...
+// Unit circle points for an arc split in segments, starting at 0 degrees
+typedef struct CircleTable {
+    int segments;                               // Number of segments (0 for unused table)
+    float arc;                                  // Arc length in degrees
+    int users;                                  // Threads reading or filling the points, never replaced while not 0
+    Vector2 points[MAX_CIRCLE_SEGMENTS + 1];    // Points as (sin, cos) of every segment start angle, plus arc end
+} CircleTable;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -84,10 +116,35 @@
 Texture2D texShapes = { 1, 1, 1, 1, 7 };                // Texture used on shapes drawing (usually a white pixel)
 Rectangle texShapesRec = { 0.0f, 0.0f, 1.0f, 1.0f };    // Texture source rectangle used on shapes drawing
 
+static CircleTable circleTables[MAX_CIRCLE_TABLES] = { 0 };     // Unit circle tables cache
+static int circleTableNext = 0;                                 // Next table to be replaced on cache miss
+static long circleTablesLock = 0;                               // Spin lock guarding table keys and users, and circleTableNext
+static SHAPES_THREAD_LOCAL float circleSmoothRadius = 0.0f;     // Last radius used to compute smooth circle segments (calling thread)
+static SHAPES_THREAD_LOCAL float circleSmoothSegments = 0.0f;   // Smooth circle segments for last radius (calling thread)
+
+static int shapesMode = SHAPES_MODE_TESSELLATED;                // Shapes drawing mode: SetShapesMode()
+static unsigned int shapesShaderId = 0;                         // Signed distance shapes shader id (loaded on first use)
+static int shapesShaderLocs[RL_MAX_SHADER_LOCATIONS] = { 0 };   // Signed distance shapes shader locations
+static bool shapesShaderFailed = false;                         // Signed distance shapes shader could not be loaded
+
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 static float EaseCubicInOut(float t, float b, float c, float d);    // Cubic easing
+static void GetCirclePoints(float startAngle, float arc, int *segments, Vector2 *points);  // Get unit circle points for an arc (cached)
+static float GetCircleSmoothSegments(float radius);                 // Get segments required for a smooth full circle
+static bool BeginShapesSDF(void);                                   // Begin signed distance shapes drawing (if SDF mode is enabled and supported)
+static void EndShapesSDF(void);                                     // End signed distance shapes drawing (restore default shader)
+static void DrawQuadSDF(float x0, float y0, float x1, float y1, float u0, float v0, float u1, float v1, float shape, Color color);  // Add signed distance shape quad
+static void DrawRingSDF(Vector2 center, float innerRadius, float outerRadius, Color color);     // Add signed distance ring quad (circle if innerRadius is 0)
+void UnloadShapesShader(void);                                      // Unload signed distance shapes shader
+static bool CheckPointsCulling(const Vector2 *points, int pointCount);  // Check if points bounding box is outside the visible area
+
+#if defined(SUPPORT_DRAW_CULLING)
+extern bool CheckDrawCulling(float minX, float minY, float maxX, float maxY);   // [Module: core] Check if 2D primitive bounds are outside the visible area
+#else
+    #define CheckDrawCulling(minX, minY, maxX, maxY) false
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -102,6 +159,14 @@ void SetShapesTexture(Texture2D texture, Rectangle source)
     texShapesRec = source;
 }
 
+// Set shapes drawing mode (tessellated or signed distance quads)
+// NOTE: Signed distance mode requires shaders support (not available on OpenGL 1.1), shapes are
+// still tessellated when a custom shader is active or for partial circles and rings
+void SetShapesMode(int mode)
+{
+    shapesMode = mode;
+}
+
 // Draw a pixel
 void DrawPixel(int posX, int posY, Color color)
 {
@@ -111,6 +176,8 @@ void DrawPixel(int posX, int posY, Color color)
 // Draw a pixel (Vector version)
 void DrawPixelV(Vector2 position, Color color)
 {
+    if (CheckDrawCulling(position.x, position.y, position.x + 1, position.y + 1)) return;
+
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlSetTexture(texShapes.id);
 
@@ -154,6 +221,9 @@ void DrawPixelV(Vector2 position, Color color)
 // Draw a line
 void DrawLine(int startPosX, int startPosY, int endPosX, int endPosY, Color color)
 {
+    if (CheckDrawCulling((float)((startPosX < endPosX)? startPosX : endPosX), (float)((startPosY < endPosY)? startPosY : endPosY),
+        (float)((startPosX > endPosX)? startPosX : endPosX), (float)((startPosY > endPosY)? startPosY : endPosY))) return;
+
     rlBegin(RL_LINES);
         rlColor4ub(color.r, color.g, color.b, color.a);
         rlVertex2f((float)startPosX, (float)startPosY);
@@ -164,6 +234,8 @@ void DrawLine(int startPosX, int startPosY, int endPosX, int endPosY, Color colo
 // Draw a line  (Vector version)
 void DrawLineV(Vector2 startPos, Vector2 endPos, Color color)
 {
+    if (CheckDrawCulling(fminf(startPos.x, endPos.x), fminf(startPos.y, endPos.y), fmaxf(startPos.x, endPos.x), fmaxf(startPos.y, endPos.y))) return;
+
     rlBegin(RL_LINES);
         rlColor4ub(color.r, color.g, color.b, color.a);
         rlVertex2f(startPos.x, startPos.y);
@@ -323,7 +395,7 @@ void DrawLineBezierCubic(Vector2 startPos, Vector2 endPos, Vector2 startControlP
 // Draw lines sequence
 void DrawLineStrip(Vector2 *points, int pointCount, Color color)
 {
-    if (pointCount >= 2)
+    if ((pointCount >= 2) && !CheckPointsCulling(points, pointCount))
     {
         rlBegin(RL_LINES);
             rlColor4ub(color.r, color.g, color.b, color.a);
@@ -343,11 +415,93 @@ void DrawCircle(int centerX, int centerY, float radius, Color color)
     DrawCircleV((Vector2){ (float)centerX, (float)centerY }, radius, color);
 }
 
+// Draw multiple color-filled circles
+// NOTE: Same tessellation as DrawCircleV(), all circles are added to the render batch in one go
+void DrawCircles(const Vector2 *centers, const float *radii, const Color *colors, int count)
+{
+    if (BeginShapesSDF())
+    {
+        rlBegin(RL_QUADS);
+            for (int c = 0; c < count; c++)
+            {
+                float radius = (radii[c] > 0.0f)? radii[c] : 0.1f;
+                if (CheckDrawCulling(centers[c].x - radius, centers[c].y - radius, centers[c].x + radius, centers[c].y + radius)) continue;
+
+                DrawRingSDF(centers[c], 0.0f, radius, colors[c]);
+            }
+        rlEnd();
+
+        EndShapesSDF();
+        return;
+    }
+
+    int segments = 36;
+    Vector2 points[MAX_CIRCLE_SEGMENTS + 1];
+    GetCirclePoints(0.0f, 360.0f, &segments, points);
+
+#if defined(SUPPORT_QUADS_DRAW_MODE)
+    rlSetTexture(texShapes.id);
+
+    rlBegin(RL_QUADS);
+        for (int c = 0; c < count; c++)
+        {
+            Vector2 center = centers[c];
+            float radius = (radii[c] > 0.0f)? radii[c] : 0.1f;
+            Color color = colors[c];
+
+            if (CheckDrawCulling(center.x - radius, center.y - radius, center.x + radius, center.y + radius)) continue;
+
+            // NOTE: Every QUAD actually represents two segments
+            for (int i = 0; i < segments; i += 2)
+            {
+                rlColor4ub(color.r, color.g, color.b, color.a);
+
+                rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
+                rlVertex2f(center.x, center.y);
+
+                rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+                rlVertex2f(center.x + points[i].x*radius, center.y + points[i].y*radius);
+
+                rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
+                rlVertex2f(center.x + points[i + 1].x*radius, center.y + points[i + 1].y*radius);
+
+                rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
+                rlVertex2f(center.x + points[i + 2].x*radius, center.y + points[i + 2].y*radius);
+            }
+        }
+    rlEnd();
+
+    rlSetTexture(0);
+#else
+    rlBegin(RL_TRIANGLES);
+        for (int c = 0; c < count; c++)
+        {
+            Vector2 center = centers[c];
+            float radius = (radii[c] > 0.0f)? radii[c] : 0.1f;
+            Color color = colors[c];
+
+            if (CheckDrawCulling(center.x - radius, center.y - radius, center.x + radius, center.y + radius)) continue;
+
+            for (int i = 0; i < segments; i++)
+            {
+                rlColor4ub(color.r, color.g, color.b, color.a);
+
+                rlVertex2f(center.x, center.y);
+                rlVertex2f(center.x + points[i].x*radius, center.y + points[i].y*radius);
+                rlVertex2f(center.x + points[i + 1].x*radius, center.y + points[i + 1].y*radius);
+            }
+        }
+    rlEnd();
+#endif
+}
+
 // Draw a piece of a circle
 void DrawCircleSector(Vector2 center, float radius, float startAngle, float endAngle, int segments, Color color)
 {
     if (radius <= 0.0f) radius = 0.1f;  // Avoid div by zero
 
+    if (CheckDrawCulling(center.x - radius, center.y - radius, center.x + radius, center.y + radius)) return;
+
     // Function expects (endAngle > startAngle)
     if (endAngle < startAngle)
     {
@@ -357,19 +511,31 @@ void DrawCircleSector(Vector2 center, float radius, float startAngle, float endA
         endAngle = tmp;
     }
 
+    // Full circle, drawn as a single quad in signed distance mode
+    if (((endAngle - startAngle) >= 360.0f) && BeginShapesSDF())
+    {
+        rlBegin(RL_QUADS);
+            DrawRingSDF(center, 0.0f, radius, color);
+        rlEnd();
+
+        EndShapesSDF();
+        return;
+    }
+
     int minSegments = (int)ceilf((endAngle - startAngle)/90);
 
     if (segments < minSegments)
     {
         // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
+        segments = (int)((endAngle - startAngle)*GetCircleSmoothSegments(radius)/360);
 
         if (segments <= 0) segments = minSegments;
     }
 
-    float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
+    Vector2 points[MAX_CIRCLE_SEGMENTS + 1];
+
+    GetCirclePoints(startAngle, endAngle - startAngle, &segments, points);
+    int index = 0;
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlSetTexture(texShapes.id);
@@ -384,15 +550,15 @@ void DrawCircleSector(Vector2 center, float radius, float startAngle, float endA
             rlVertex2f(center.x, center.y);
 
             rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
+            rlVertex2f(center.x + points[index].x*radius, center.y + points[index].y*radius);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*radius, center.y + cosf(DEG2RAD*(angle + stepLength))*radius);
+            rlVertex2f(center.x + points[index + 1].x*radius, center.y + points[index + 1].y*radius);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength*2))*radius, center.y + cosf(DEG2RAD*(angle + stepLength*2))*radius);
+            rlVertex2f(center.x + points[index + 2].x*radius, center.y + points[index + 2].y*radius);
 
-            angle += (stepLength*2);
+            index += 2;
         }
 
         // NOTE: In case number of segments is odd, we add one last piece to the cake
@@ -404,10 +570,10 @@ void DrawCircleSector(Vector2 center, float radius, float startAngle, float endA
             rlVertex2f(center.x, center.y);
 
             rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
+            rlVertex2f(center.x + points[index].x*radius, center.y + points[index].y*radius);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*radius, center.y + cosf(DEG2RAD*(angle + stepLength))*radius);
+            rlVertex2f(center.x + points[index + 1].x*radius, center.y + points[index + 1].y*radius);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
             rlVertex2f(center.x, center.y);
@@ -422,10 +588,10 @@ void DrawCircleSector(Vector2 center, float radius, float startAngle, float endA
             rlColor4ub(color.r, color.g, color.b, color.a);
 
             rlVertex2f(center.x, center.y);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*radius, center.y + cosf(DEG2RAD*(angle + stepLength))*radius);
+            rlVertex2f(center.x + points[index].x*radius, center.y + points[index].y*radius);
+            rlVertex2f(center.x + points[index + 1].x*radius, center.y + points[index + 1].y*radius);
 
-            angle += stepLength;
+            index++;
         }
     rlEnd();
 #endif
@@ -436,6 +602,8 @@ void DrawCircleSectorLines(Vector2 center, float radius, float startAngle, float
 {
     if (radius <= 0.0f) radius = 0.1f;  // Avoid div by zero issue
 
+    if (CheckDrawCulling(center.x - radius, center.y - radius, center.x + radius, center.y + radius)) return;
+
     // Function expects (endAngle > startAngle)
     if (endAngle < startAngle)
     {
@@ -450,14 +618,15 @@ void DrawCircleSectorLines(Vector2 center, float radius, float startAngle, float
     if (segments < minSegments)
     {
         // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
+        segments = (int)((endAngle - startAngle)*GetCircleSmoothSegments(radius)/360);
 
         if (segments <= 0) segments = minSegments;
     }
 
-    float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
+    Vector2 points[MAX_CIRCLE_SEGMENTS + 1];
+
+    GetCirclePoints(startAngle, endAngle - startAngle, &segments, points);
+    int index = 0;
     bool showCapLines = true;
 
     rlBegin(RL_LINES);
@@ -465,24 +634,24 @@ void DrawCircleSectorLines(Vector2 center, float radius, float startAngle, float
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
             rlVertex2f(center.x, center.y);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
+            rlVertex2f(center.x + points[index].x*radius, center.y + points[index].y*radius);
         }
 
         for (int i = 0; i < segments; i++)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
 
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*radius, center.y + cosf(DEG2RAD*(angle + stepLength))*radius);
+            rlVertex2f(center.x + points[index].x*radius, center.y + points[index].y*radius);
+            rlVertex2f(center.x + points[index + 1].x*radius, center.y + points[index + 1].y*radius);
 
-            angle += stepLength;
+            index++;
         }
 
         if (showCapLines)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
             rlVertex2f(center.x, center.y);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
+            rlVertex2f(center.x + points[index].x*radius, center.y + points[index].y*radius);
         }
     rlEnd();
 }
@@ -491,15 +660,22 @@ void DrawCircleSectorLines(Vector2 center, float radius, float startAngle, float
 // NOTE: Gradient goes from center (color1) to border (color2)
 void DrawCircleGradient(int centerX, int centerY, float radius, Color color1, Color color2)
 {
+    if (CheckDrawCulling(centerX - radius, centerY - radius, centerX + radius, centerY + radius)) return;
+
+    // NOTE: Shape is drawn in 10 degrees steps
+    int segments = 36;
+    Vector2 points[MAX_CIRCLE_SEGMENTS + 1];
+    GetCirclePoints(0.0f, 360.0f, &segments, points);
+
     rlBegin(RL_TRIANGLES);
-        for (int i = 0; i < 360; i += 10)
+        for (int i = 0; i < segments; i++)
         {
             rlColor4ub(color1.r, color1.g, color1.b, color1.a);
             rlVertex2f((float)centerX, (float)centerY);
             rlColor4ub(color2.r, color2.g, color2.b, color2.a);
-            rlVertex2f((float)centerX + sinf(DEG2RAD*i)*radius, (float)centerY + cosf(DEG2RAD*i)*radius);
+            rlVertex2f((float)centerX + points[i].x*radius, (float)centerY + points[i].y*radius);
             rlColor4ub(color2.r, color2.g, color2.b, color2.a);
-            rlVertex2f((float)centerX + sinf(DEG2RAD*(i + 10))*radius, (float)centerY + cosf(DEG2RAD*(i + 10))*radius);
+            rlVertex2f((float)centerX + points[i + 1].x*radius, (float)centerY + points[i + 1].y*radius);
         }
     rlEnd();
 }
@@ -514,14 +690,31 @@ void DrawCircleV(Vector2 center, float radius, Color color)
 // Draw circle outline
 void DrawCircleLines(int centerX, int centerY, float radius, Color color)
 {
+    if (CheckDrawCulling(centerX - radius, centerY - radius, centerX + radius, centerY + radius)) return;
+
+    // Outline drawn as a one pixel wide ring in signed distance mode
+    if (BeginShapesSDF())
+    {
+        rlBegin(RL_QUADS);
+            DrawRingSDF((Vector2){ (float)centerX, (float)centerY }, (radius > 0.5f)? radius - 0.5f : 0.0f, radius + 0.5f, color);
+        rlEnd();
+
+        EndShapesSDF();
+        return;
+    }
+
+    // NOTE: Shape is drawn in 10 degrees steps
+    int segments = 36;
+    Vector2 points[MAX_CIRCLE_SEGMENTS + 1];
+    GetCirclePoints(0.0f, 360.0f, &segments, points);
+
     rlBegin(RL_LINES);
         rlColor4ub(color.r, color.g, color.b, color.a);
 
-        // NOTE: Circle outline is drawn pixel by pixel every degree (0 to 360)
-        for (int i = 0; i < 360; i += 10)
+        for (int i = 0; i < segments; i++)
         {
-            rlVertex2f(centerX + sinf(DEG2RAD*i)*radius, centerY + cosf(DEG2RAD*i)*radius);
-            rlVertex2f(centerX + sinf(DEG2RAD*(i + 10))*radius, centerY + cosf(DEG2RAD*(i + 10))*radius);
+            rlVertex2f(centerX + points[i].x*radius, centerY + points[i].y*radius);
+            rlVertex2f(centerX + points[i + 1].x*radius, centerY + points[i + 1].y*radius);
         }
     rlEnd();
 }
@@ -529,13 +722,20 @@ void DrawCircleLines(int centerX, int centerY, float radius, Color color)
 // Draw ellipse
 void DrawEllipse(int centerX, int centerY, float radiusH, float radiusV, Color color)
 {
+    if (CheckDrawCulling(centerX - radiusH, centerY - radiusV, centerX + radiusH, centerY + radiusV)) return;
+
+    // NOTE: Shape is drawn in 10 degrees steps
+    int segments = 36;
+    Vector2 points[MAX_CIRCLE_SEGMENTS + 1];
+    GetCirclePoints(0.0f, 360.0f, &segments, points);
+
     rlBegin(RL_TRIANGLES);
-        for (int i = 0; i < 360; i += 10)
+        for (int i = 0; i < segments; i++)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
             rlVertex2f((float)centerX, (float)centerY);
-            rlVertex2f((float)centerX + sinf(DEG2RAD*i)*radiusH, (float)centerY + cosf(DEG2RAD*i)*radiusV);
-            rlVertex2f((float)centerX + sinf(DEG2RAD*(i + 10))*radiusH, (float)centerY + cosf(DEG2RAD*(i + 10))*radiusV);
+            rlVertex2f((float)centerX + points[i].x*radiusH, (float)centerY + points[i].y*radiusV);
+            rlVertex2f((float)centerX + points[i + 1].x*radiusH, (float)centerY + points[i + 1].y*radiusV);
         }
     rlEnd();
 }
@@ -543,12 +743,19 @@ void DrawEllipse(int centerX, int centerY, float radiusH, float radiusV, Color c
 // Draw ellipse outline
 void DrawEllipseLines(int centerX, int centerY, float radiusH, float radiusV, Color color)
 {
+    if (CheckDrawCulling(centerX - radiusH, centerY - radiusV, centerX + radiusH, centerY + radiusV)) return;
+
+    // NOTE: Shape is drawn in 10 degrees steps
+    int segments = 36;
+    Vector2 points[MAX_CIRCLE_SEGMENTS + 1];
+    GetCirclePoints(0.0f, 360.0f, &segments, points);
+
     rlBegin(RL_LINES);
-        for (int i = 0; i < 360; i += 10)
+        for (int i = 0; i < segments; i++)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f(centerX + sinf(DEG2RAD*i)*radiusH, centerY + cosf(DEG2RAD*i)*radiusV);
-            rlVertex2f(centerX + sinf(DEG2RAD*(i + 10))*radiusH, centerY + cosf(DEG2RAD*(i + 10))*radiusV);
+            rlVertex2f(centerX + points[i].x*radiusH, centerY + points[i].y*radiusV);
+            rlVertex2f(centerX + points[i + 1].x*radiusH, centerY + points[i + 1].y*radiusV);
         }
     rlEnd();
 }
@@ -582,8 +789,7 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, float startA
     if (segments < minSegments)
     {
         // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/outerRadius, 2) - 1);
-        segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
+        segments = (int)((endAngle - startAngle)*GetCircleSmoothSegments(outerRadius)/360);
 
         if (segments <= 0) segments = minSegments;
     }
@@ -595,8 +801,23 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, float startA
         return;
     }
 
-    float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
+    if (CheckDrawCulling(center.x - outerRadius, center.y - outerRadius, center.x + outerRadius, center.y + outerRadius)) return;
+
+    // Full ring, drawn as a single quad in signed distance mode
+    if (((endAngle - startAngle) >= 360.0f) && BeginShapesSDF())
+    {
+        rlBegin(RL_QUADS);
+            DrawRingSDF(center, innerRadius, outerRadius, color);
+        rlEnd();
+
+        EndShapesSDF();
+        return;
+    }
+
+    Vector2 points[MAX_CIRCLE_SEGMENTS + 1];
+
+    GetCirclePoints(startAngle, endAngle - startAngle, &segments, points);
+    int index = 0;
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlSetTexture(texShapes.id);
@@ -607,18 +828,18 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, float startA
             rlColor4ub(color.r, color.g, color.b, color.a);
 
             rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*innerRadius, center.y + cosf(DEG2RAD*angle)*innerRadius);
+            rlVertex2f(center.x + points[index].x*innerRadius, center.y + points[index].y*innerRadius);
 
             rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
+            rlVertex2f(center.x + points[index].x*outerRadius, center.y + points[index].y*outerRadius);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*outerRadius);
+            rlVertex2f(center.x + points[index + 1].x*outerRadius, center.y + points[index + 1].y*outerRadius);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*innerRadius);
+            rlVertex2f(center.x + points[index + 1].x*innerRadius, center.y + points[index + 1].y*innerRadius);
 
-            angle += stepLength;
+            index++;
         }
     rlEnd();
 
@@ -629,15 +850,15 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, float startA
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
 
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*innerRadius, center.y + cosf(DEG2RAD*angle)*innerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*innerRadius);
+            rlVertex2f(center.x + points[index].x*innerRadius, center.y + points[index].y*innerRadius);
+            rlVertex2f(center.x + points[index].x*outerRadius, center.y + points[index].y*outerRadius);
+            rlVertex2f(center.x + points[index + 1].x*innerRadius, center.y + points[index + 1].y*innerRadius);
 
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*innerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*outerRadius);
+            rlVertex2f(center.x + points[index + 1].x*innerRadius, center.y + points[index + 1].y*innerRadius);
+            rlVertex2f(center.x + points[index].x*outerRadius, center.y + points[index].y*outerRadius);
+            rlVertex2f(center.x + points[index + 1].x*outerRadius, center.y + points[index + 1].y*outerRadius);
 
-            angle += stepLength;
+            index++;
         }
     rlEnd();
 #endif
@@ -672,8 +893,7 @@ void DrawRingLines(Vector2 center, float innerRadius, float outerRadius, float s
     if (segments < minSegments)
     {
         // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/outerRadius, 2) - 1);
-        segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
+        segments = (int)((endAngle - startAngle)*GetCircleSmoothSegments(outerRadius)/360);
 
         if (segments <= 0) segments = minSegments;
     }
@@ -684,36 +904,40 @@ void DrawRingLines(Vector2 center, float innerRadius, float outerRadius, float s
         return;
     }
 
-    float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
+    if (CheckDrawCulling(center.x - outerRadius, center.y - outerRadius, center.x + outerRadius, center.y + outerRadius)) return;
+
+    Vector2 points[MAX_CIRCLE_SEGMENTS + 1];
+
+    GetCirclePoints(startAngle, endAngle - startAngle, &segments, points);
+    int index = 0;
     bool showCapLines = true;
 
     rlBegin(RL_LINES);
         if (showCapLines)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*innerRadius, center.y + cosf(DEG2RAD*angle)*innerRadius);
+            rlVertex2f(center.x + points[index].x*outerRadius, center.y + points[index].y*outerRadius);
+            rlVertex2f(center.x + points[index].x*innerRadius, center.y + points[index].y*innerRadius);
         }
 
         for (int i = 0; i < segments; i++)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
 
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*outerRadius);
+            rlVertex2f(center.x + points[index].x*outerRadius, center.y + points[index].y*outerRadius);
+            rlVertex2f(center.x + points[index + 1].x*outerRadius, center.y + points[index + 1].y*outerRadius);
 
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*innerRadius, center.y + cosf(DEG2RAD*angle)*innerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*innerRadius);
+            rlVertex2f(center.x + points[index].x*innerRadius, center.y + points[index].y*innerRadius);
+            rlVertex2f(center.x + points[index + 1].x*innerRadius, center.y + points[index + 1].y*innerRadius);
 
-            angle += stepLength;
+            index++;
         }
 
         if (showCapLines)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + sinf(DEG2RAD*angle)*innerRadius, center.y + cosf(DEG2RAD*angle)*innerRadius);
+            rlVertex2f(center.x + points[index].x*outerRadius, center.y + points[index].y*outerRadius);
+            rlVertex2f(center.x + points[index].x*innerRadius, center.y + points[index].y*innerRadius);
         }
     rlEnd();
 }
@@ -777,6 +1001,9 @@ void DrawRectanglePro(Rectangle rec, Vector2 origin, float rotation, Color color
         bottomRight.y = y + (dx + rec.width)*sinRotation + (dy + rec.height)*cosRotation;
     }
 
+    if (CheckDrawCulling(fminf(fminf(topLeft.x, topRight.x), fminf(bottomLeft.x, bottomRight.x)), fminf(fminf(topLeft.y, topRight.y), fminf(bottomLeft.y, bottomRight.y)),
+        fmaxf(fmaxf(topLeft.x, topRight.x), fmaxf(bottomLeft.x, bottomRight.x)), fmaxf(fmaxf(topLeft.y, topRight.y), fmaxf(bottomLeft.y, bottomRight.y)))) return;
+
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlSetTexture(texShapes.id);
 
@@ -835,6 +1062,8 @@ void DrawRectangleGradientH(int posX, int posY, int width, int height, Color col
 // NOTE: Colors refer to corners, starting at top-lef corner and counter-clockwise
 void DrawRectangleGradientEx(Rectangle rec, Color col1, Color col2, Color col3, Color col4)
 {
+    if (CheckDrawCulling(rec.x, rec.y, rec.x + rec.width, rec.y + rec.height)) return;
+
     rlSetTexture(texShapes.id);
 
     rlBegin(RL_QUADS);
@@ -871,6 +1100,8 @@ void DrawRectangleLines(int posX, int posY, int width, int height, Color color)
     DrawRectangle(posX, posY + height - 1, width, 1, color);
     DrawRectangle(posX, posY + 1, 1, height - 2, color);
 #else
+    if (CheckDrawCulling((float)posX, (float)posY, (float)(posX + width + 1), (float)(posY + height + 1))) return;
+
     rlBegin(RL_LINES);
         rlColor4ub(color.r, color.g, color.b, color.a);
         rlVertex2f(posX + 1, posY + 1);
@@ -935,16 +1166,39 @@ void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color co
     float radius = (rec.width > rec.height)? (rec.height*roundness)/2 : (rec.width*roundness)/2;
     if (radius <= 0.0f) return;
 
+    if (CheckDrawCulling(rec.x, rec.y, rec.x + rec.width, rec.y + rec.height)) return;
+
+    // Drawn as one quad per quadrant in signed distance mode, shape coordinates are relative to the
+    // quadrant corner center in corner radius units (mirrored so every quadrant is the top-right one)
+    if (BeginShapesSDF())
+    {
+        Vector2 center = { rec.x + rec.width/2, rec.y + rec.height/2 };
+        float extentX = rec.width/2 + 1.0f;
+        float extentY = rec.height/2 + 1.0f;
+        float innerU = -(rec.width/2 - radius)/radius;
+        float innerV = -(rec.height/2 - radius)/radius;
+        float outerU = (extentX - (rec.width/2 - radius))/radius;
+        float outerV = (extentY - (rec.height/2 - radius))/radius;
+
+        rlBegin(RL_QUADS);
+            DrawQuadSDF(center.x - extentX, center.y - extentY, center.x, center.y, outerU, outerV, innerU, innerV, -1.0f, color);
+            DrawQuadSDF(center.x, center.y - extentY, center.x + extentX, center.y, innerU, outerV, outerU, innerV, -1.0f, color);
+            DrawQuadSDF(center.x, center.y, center.x + extentX, center.y + extentY, innerU, innerV, outerU, outerV, -1.0f, color);
+            DrawQuadSDF(center.x - extentX, center.y, center.x, center.y + extentY, outerU, innerV, innerU, outerV, -1.0f, color);
+        rlEnd();
+
+        EndShapesSDF();
+        return;
+    }
+
     // Calculate number of segments to use for the corners
     if (segments < 4)
     {
         // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = (int)(ceilf(2*PI/th)/4.0f);
+        segments = (int)(GetCircleSmoothSegments(radius)/4.0f);
         if (segments <= 0) segments = 4;
     }
 
-    float stepLength = 90.0f/(float)segments;
 
     /*
     Quick sketch to make sense of all of this,
@@ -981,7 +1235,9 @@ void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color co
         // Draw all the 4 corners: [1] Upper Left Corner, [3] Upper Right Corner, [5] Lower Right Corner, [7] Lower Left Corner
         for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
         {
-            float angle = angles[k];
+            Vector2 points[MAX_CIRCLE_SEGMENTS + 1];
+            GetCirclePoints(angles[k], 90.0f, &segments, points);
+            int index = 0;
             const Vector2 center = centers[k];
 
             // NOTE: Every QUAD actually represents two segments
@@ -991,12 +1247,12 @@ void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color co
                 rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
                 rlVertex2f(center.x, center.y);
                 rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
+                rlVertex2f(center.x + points[index].x*radius, center.y + points[index].y*radius);
                 rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*radius, center.y + cosf(DEG2RAD*(angle + stepLength))*radius);
+                rlVertex2f(center.x + points[index + 1].x*radius, center.y + points[index + 1].y*radius);
                 rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-                rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength*2))*radius, center.y + cosf(DEG2RAD*(angle + stepLength*2))*radius);
-                angle += (stepLength*2);
+                rlVertex2f(center.x + points[index + 2].x*radius, center.y + points[index + 2].y*radius);
+                index += 2;
             }
 
             // NOTE: In case number of segments is odd, we add one last piece to the cake
@@ -1006,9 +1262,9 @@ void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color co
                 rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
                 rlVertex2f(center.x, center.y);
                 rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
+                rlVertex2f(center.x + points[index].x*radius, center.y + points[index].y*radius);
                 rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*radius, center.y + cosf(DEG2RAD*(angle + stepLength))*radius);
+                rlVertex2f(center.x + points[index + 1].x*radius, center.y + points[index + 1].y*radius);
                 rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
                 rlVertex2f(center.x, center.y);
             }
@@ -1077,15 +1333,17 @@ void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color co
         // Draw all of the 4 corners: [1] Upper Left Corner, [3] Upper Right Corner, [5] Lower Right Corner, [7] Lower Left Corner
         for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
         {
-            float angle = angles[k];
+            Vector2 points[MAX_CIRCLE_SEGMENTS + 1];
+            GetCirclePoints(angles[k], 90.0f, &segments, points);
+            int index = 0;
             const Vector2 center = centers[k];
             for (int i = 0; i < segments; i++)
             {
                 rlColor4ub(color.r, color.g, color.b, color.a);
                 rlVertex2f(center.x, center.y);
-                rlVertex2f(center.x + sinf(DEG2RAD*angle)*radius, center.y + cosf(DEG2RAD*angle)*radius);
-                rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*radius, center.y + cosf(DEG2RAD*(angle + stepLength))*radius);
-                angle += stepLength;
+                rlVertex2f(center.x + points[index].x*radius, center.y + points[index].y*radius);
+                rlVertex2f(center.x + points[index + 1].x*radius, center.y + points[index + 1].y*radius);
+                index++;
             }
         }
 
@@ -1155,16 +1413,16 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, flo
     float radius = (rec.width > rec.height)? (rec.height*roundness)/2 : (rec.width*roundness)/2;
     if (radius <= 0.0f) return;
 
+    if (CheckDrawCulling(rec.x - lineThick, rec.y - lineThick, rec.x + rec.width + lineThick, rec.y + rec.height + lineThick)) return;
+
     // Calculate number of segments to use for the corners
     if (segments < 4)
     {
         // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = (int)(ceilf(2*PI/th)/2.0f);
+        segments = (int)(GetCircleSmoothSegments(radius)/2.0f);
         if (segments <= 0) segments = 4;
     }
 
-    float stepLength = 90.0f/(float)segments;
     const float outerRadius = radius + lineThick, innerRadius = radius;
 
     /*
@@ -1210,21 +1468,23 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, flo
             // Draw all the 4 corners first: Upper Left Corner, Upper Right Corner, Lower Right Corner, Lower Left Corner
             for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
             {
-                float angle = angles[k];
+                Vector2 points[MAX_CIRCLE_SEGMENTS + 1];
+                GetCirclePoints(angles[k], 90.0f, &segments, points);
+                int index = 0;
                 const Vector2 center = centers[k];
                 for (int i = 0; i < segments; i++)
                 {
                     rlColor4ub(color.r, color.g, color.b, color.a);
                     rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
-                    rlVertex2f(center.x + sinf(DEG2RAD*angle)*innerRadius, center.y + cosf(DEG2RAD*angle)*innerRadius);
+                    rlVertex2f(center.x + points[index].x*innerRadius, center.y + points[index].y*innerRadius);
                     rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                    rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
+                    rlVertex2f(center.x + points[index].x*outerRadius, center.y + points[index].y*outerRadius);
                     rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                    rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*outerRadius);
+                    rlVertex2f(center.x + points[index + 1].x*outerRadius, center.y + points[index + 1].y*outerRadius);
                     rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-                    rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*innerRadius);
+                    rlVertex2f(center.x + points[index + 1].x*innerRadius, center.y + points[index + 1].y*innerRadius);
 
-                    angle += stepLength;
+                    index++;
                 }
             }
 
@@ -1280,22 +1540,24 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, flo
             // Draw all of the 4 corners first: Upper Left Corner, Upper Right Corner, Lower Right Corner, Lower Left Corner
             for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
             {
-                float angle = angles[k];
+                Vector2 points[MAX_CIRCLE_SEGMENTS + 1];
+                GetCirclePoints(angles[k], 90.0f, &segments, points);
+                int index = 0;
                 const Vector2 center = centers[k];
 
                 for (int i = 0; i < segments; i++)
                 {
                     rlColor4ub(color.r, color.g, color.b, color.a);
 
-                    rlVertex2f(center.x + sinf(DEG2RAD*angle)*innerRadius, center.y + cosf(DEG2RAD*angle)*innerRadius);
-                    rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-                    rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*innerRadius);
+                    rlVertex2f(center.x + points[index].x*innerRadius, center.y + points[index].y*innerRadius);
+                    rlVertex2f(center.x + points[index].x*outerRadius, center.y + points[index].y*outerRadius);
+                    rlVertex2f(center.x + points[index + 1].x*innerRadius, center.y + points[index + 1].y*innerRadius);
 
-                    rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*innerRadius);
-                    rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-                    rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*outerRadius);
+                    rlVertex2f(center.x + points[index + 1].x*innerRadius, center.y + points[index + 1].y*innerRadius);
+                    rlVertex2f(center.x + points[index].x*outerRadius, center.y + points[index].y*outerRadius);
+                    rlVertex2f(center.x + points[index + 1].x*outerRadius, center.y + points[index + 1].y*outerRadius);
 
-                    angle += stepLength;
+                    index++;
                 }
             }
 
@@ -1345,15 +1607,17 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, flo
             // Draw all the 4 corners first: Upper Left Corner, Upper Right Corner, Lower Right Corner, Lower Left Corner
             for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
             {
-                float angle = angles[k];
+                Vector2 points[MAX_CIRCLE_SEGMENTS + 1];
+                GetCirclePoints(angles[k], 90.0f, &segments, points);
+                int index = 0;
                 const Vector2 center = centers[k];
 
                 for (int i = 0; i < segments; i++)
                 {
                     rlColor4ub(color.r, color.g, color.b, color.a);
-                    rlVertex2f(center.x + sinf(DEG2RAD*angle)*outerRadius, center.y + cosf(DEG2RAD*angle)*outerRadius);
-                    rlVertex2f(center.x + sinf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + cosf(DEG2RAD*(angle + stepLength))*outerRadius);
-                    angle += stepLength;
+                    rlVertex2f(center.x + points[index].x*outerRadius, center.y + points[index].y*outerRadius);
+                    rlVertex2f(center.x + points[index + 1].x*outerRadius, center.y + points[index + 1].y*outerRadius);
+                    index++;
                 }
             }
 
@@ -1373,6 +1637,8 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, flo
 // NOTE: Vertex must be provided in counter-clockwise order
 void DrawTriangle(Vector2 v1, Vector2 v2, Vector2 v3, Color color)
 {
+    if (CheckDrawCulling(fminf(v1.x, fminf(v2.x, v3.x)), fminf(v1.y, fminf(v2.y, v3.y)), fmaxf(v1.x, fmaxf(v2.x, v3.x)), fmaxf(v1.y, fmaxf(v2.y, v3.y)))) return;
+
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlSetTexture(texShapes.id);
 
@@ -1407,6 +1673,8 @@ void DrawTriangle(Vector2 v1, Vector2 v2, Vector2 v3, Color color)
 // NOTE: Vertex must be provided in counter-clockwise order
 void DrawTriangleLines(Vector2 v1, Vector2 v2, Vector2 v3, Color color)
 {
+    if (CheckDrawCulling(fminf(v1.x, fminf(v2.x, v3.x)), fminf(v1.y, fminf(v2.y, v3.y)), fmaxf(v1.x, fmaxf(v2.x, v3.x)), fmaxf(v1.y, fmaxf(v2.y, v3.y)))) return;
+
     rlBegin(RL_LINES);
         rlColor4ub(color.r, color.g, color.b, color.a);
         rlVertex2f(v1.x, v1.y);
@@ -1425,7 +1693,7 @@ void DrawTriangleLines(Vector2 v1, Vector2 v2, Vector2 v3, Color color)
 // By default, following vertex should be provided in counter-clockwise order
 void DrawTriangleFan(Vector2 *points, int pointCount, Color color)
 {
-    if (pointCount >= 3)
+    if ((pointCount >= 3) && !CheckPointsCulling(points, pointCount))
     {
         rlSetTexture(texShapes.id);
         rlBegin(RL_QUADS);
@@ -1454,7 +1722,7 @@ void DrawTriangleFan(Vector2 *points, int pointCount, Color color)
 // NOTE: Every new vertex connects with previous two
 void DrawTriangleStrip(Vector2 *points, int pointCount, Color color)
 {
-    if (pointCount >= 3)
+    if ((pointCount >= 3) && !CheckPointsCulling(points, pointCount))
     {
         rlBegin(RL_TRIANGLES);
             rlColor4ub(color.r, color.g, color.b, color.a);
@@ -1481,6 +1749,8 @@ void DrawTriangleStrip(Vector2 *points, int pointCount, Color color)
 // Draw a regular polygon of n sides (Vector version)
 void DrawPoly(Vector2 center, int sides, float radius, float rotation, Color color)
 {
+    if (CheckDrawCulling(center.x - radius, center.y - radius, center.x + radius, center.y + radius)) return;
+
     if (sides < 3) sides = 3;
     float centralAngle = rotation;
 
@@ -1526,6 +1796,8 @@ void DrawPoly(Vector2 center, int sides, float radius, float rotation, Color col
 // Draw a polygon outline of n sides
 void DrawPolyLines(Vector2 center, int sides, float radius, float rotation, Color color)
 {
+    if (CheckDrawCulling(center.x - radius, center.y - radius, center.x + radius, center.y + radius)) return;
+
     if (sides < 3) sides = 3;
     float centralAngle = rotation;
 
@@ -1543,6 +1815,8 @@ void DrawPolyLines(Vector2 center, int sides, float radius, float rotation, Colo
 
 void DrawPolyLinesEx(Vector2 center, int sides, float radius, float rotation, float lineThick, Color color)
 {
+    if (CheckDrawCulling(center.x - radius, center.y - radius, center.x + radius, center.y + radius)) return;
+
     if (sides < 3) sides = 3;
     float centralAngle = rotation;
     float exteriorAngle = 360.0f/(float)sides;
@@ -1827,6 +2101,27 @@ Rectangle GetCollisionRec(Rectangle rec1, Rectangle rec2)
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
 
+// Check if points bounding box is outside the visible area
+static bool CheckPointsCulling(const Vector2 *points, int pointCount)
+{
+#if defined(SUPPORT_DRAW_CULLING)
+    Vector2 min = points[0];
+    Vector2 max = points[0];
+
+    for (int i = 1; i < pointCount; i++)
+    {
+        min.x = fminf(min.x, points[i].x);
+        min.y = fminf(min.y, points[i].y);
+        max.x = fmaxf(max.x, points[i].x);
+        max.y = fmaxf(max.y, points[i].y);
+    }
+
+    return CheckDrawCulling(min.x, min.y, max.x, max.y);
+#else
+    return false;
+#endif
+}
+
 // Cubic easing in-out
 // NOTE: Used by DrawLineBezier() only
 static float EaseCubicInOut(float t, float b, float c, float d)
@@ -1838,4 +2133,263 @@ static float EaseCubicInOut(float t, float b, float c, float d)
     return 0.5f*c*(t*t*t + 2.0f) + b;
 }
 
+// Get unit circle points (sin, cos) for an arc split in segments, starting at startAngle (degrees)
+// NOTE: Points are computed once per segments/arc pair and cached, on every call they are only
+// rotated to startAngle (no trigonometry per segment) into points, that must fit MAX_CIRCLE_SEGMENTS + 1
+// points (segments + 1 are written). Segments are clamped to [1..MAX_CIRCLE_SEGMENTS]
+static void GetCirclePoints(float startAngle, float arc, int *segments, Vector2 *points)
+{
+    if (*segments < 1) *segments = 1;
+    if (*segments > MAX_CIRCLE_SEGMENTS) *segments = MAX_CIRCLE_SEGMENTS;
+
+    CircleTable *table = NULL;
+    bool fill = false;
+
+    // NOTE: The lock is only held to find and pin a table, points are read or filled outside of it,
+    // a pinned table is never replaced by another thread on a cache miss
+    SHAPES_LOCK(&circleTablesLock);
+
+    for (int i = 0; i < MAX_CIRCLE_TABLES; i++)
+    {
+        if ((circleTables[i].segments == *segments) && (circleTables[i].arc == arc))
+        {
+            table = &circleTables[i];
+            break;
+        }
+    }
+
+    // Cache miss: replace the next unpinned table, kept out of lookups (segments = 0) until filled
+    for (int i = 0; (table == NULL) && (i < MAX_CIRCLE_TABLES); i++)
+    {
+        CircleTable *next = &circleTables[circleTableNext];
+        circleTableNext = (circleTableNext + 1)%MAX_CIRCLE_TABLES;
+
+        if (next->users == 0)
+        {
+            table = next;
+            table->segments = 0;
+            fill = true;
+        }
+    }
+
+    if (table != NULL) table->users++;
+    SHAPES_UNLOCK(&circleTablesLock);
+
+    float stepLength = arc/(float)*segments;
+
+    if (table == NULL)
+    {
+        // Every table pinned by other threads, compute points without caching them
+        for (int i = 0; i <= *segments; i++) points[i] = (Vector2){ sinf(DEG2RAD*(startAngle + stepLength*i)), cosf(DEG2RAD*(startAngle + stepLength*i)) };
+        return;
+    }
+
+    if (fill)
+    {
+        for (int i = 0; i <= *segments; i++) table->points[i] = (Vector2){ sinf(DEG2RAD*stepLength*i), cosf(DEG2RAD*stepLength*i) };
+    }
+
+    if (startAngle == 0.0f) memcpy(points, table->points, (*segments + 1)*sizeof(Vector2));
+    else
+    {
+        // Rotate points: sin(a + b) = sin(a)*cos(b) + cos(a)*sin(b), cos(a + b) = cos(a)*cos(b) - sin(a)*sin(b)
+        float sinStart = sinf(DEG2RAD*startAngle);
+        float cosStart = cosf(DEG2RAD*startAngle);
+
+        for (int i = 0; i <= *segments; i++)
+        {
+            Vector2 point = table->points[i];
+            points[i] = (Vector2){ point.x*cosStart + point.y*sinStart, point.y*cosStart - point.x*sinStart };
+        }
+    }
+
+    SHAPES_LOCK(&circleTablesLock);
+    if (fill)
+    {
+        table->segments = *segments;
+        table->arc = arc;
+    }
+    table->users--;
+    SHAPES_UNLOCK(&circleTablesLock);
+}
+
+// Get segments required for a smooth full circle (not rounded down), based on the error rate (usually 0.5f)
+// NOTE: Last radius is cached per thread, shapes drawn repeatedly with the same radius skip the computation
+static float GetCircleSmoothSegments(float radius)
+{
+    if (radius != circleSmoothRadius)
+    {
+        // Calculate the maximum angle between segments based on the error rate
+        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
+
+        circleSmoothRadius = radius;
+        circleSmoothSegments = ceilf(2*PI/th);
+    }
+
+    return circleSmoothSegments;
+}
+
+// Begin signed distance shapes drawing (if SDF mode is enabled and supported)
+// NOTE: Shader is loaded on first use, render batch is flushed when switching shaders
+static bool BeginShapesSDF(void)
+{
+    if ((shapesMode != SHAPES_MODE_SDF) || shapesShaderFailed || (rlGetVersion() == RL_OPENGL_11)) return false;
+
+    // Command buffers do not record shaders: switching here would touch GL state from a worker thread and
+    // the recorded quads would be drawn with the default shader on submit, keep tessellated shapes instead
+    if (rlIsCommandBufferRecording()) return false;
+
+    // Custom shader active (BeginShaderMode()), keep tessellated shapes so the custom shader applies
+    if (rlGetShaderIdCurrent() != rlGetShaderIdDefault()) return false;
+
+    if (shapesShaderId == 0)
+    {
+        // Vertex shader: shape coordinates come in texcoords and shape parameter in position z
+        const char *vsCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+        "#version 120                       \n"
+        "attribute vec3 vertexPosition;     \n"
+        "attribute vec2 vertexTexCoord;     \n"
+        "attribute vec4 vertexColor;        \n"
+        "varying vec2 fragTexCoord;         \n"
+        "varying float fragShape;           \n"
+        "varying vec4 fragColor;            \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+        "#version 330                       \n"
+        "in vec3 vertexPosition;            \n"
+        "in vec2 vertexTexCoord;            \n"
+        "in vec4 vertexColor;               \n"
+        "out vec2 fragTexCoord;             \n"
+        "out float fragShape;               \n"
+        "out vec4 fragColor;                \n"
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+        "#version 100                       \n"
+        "attribute vec3 vertexPosition;     \n"
+        "attribute vec2 vertexTexCoord;     \n"
+        "attribute vec4 vertexColor;        \n"
+        "varying vec2 fragTexCoord;         \n"
+        "varying float fragShape;           \n"
+        "varying vec4 fragColor;            \n"
+#endif
+        "uniform mat4 mvp;                  \n"
+        "void main()                        \n"
+        "{                                  \n"
+        "    fragTexCoord = vertexTexCoord; \n"
+        "    fragShape = vertexPosition.z;  \n"
+        "    fragColor = vertexColor;       \n"
+        "    gl_Position = mvp*vec4(vertexPosition.xy, 0.0, 1.0); \n"
+        "    gl_Position.z = 0.0;           \n"
+        "}                                  \n";
+
+        // Fragment shader: distance to shape edge in shape units, converted to pixel coverage with
+        // the screen-space distance gradient (analytic antialiasing, independent of scale)
+        const char *fsCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+        "#version 120                       \n"
+        "varying vec2 fragTexCoord;         \n"
+        "varying float fragShape;           \n"
+        "varying vec4 fragColor;            \n"
+        "#define finalColor gl_FragColor    \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+        "#version 330                       \n"
+        "in vec2 fragTexCoord;              \n"
+        "in float fragShape;                \n"
+        "in vec4 fragColor;                 \n"
+        "out vec4 finalColor;               \n"
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+        "#version 100                       \n"
+        "#extension GL_OES_standard_derivatives : enable \n"
+        "precision mediump float;           \n"
+        "varying vec2 fragTexCoord;         \n"
+        "varying float fragShape;           \n"
+        "varying vec4 fragColor;            \n"
+        "#define finalColor gl_FragColor    \n"
+#endif
+        "void main()                        \n"
+        "{                                  \n"
+        "    float d = 0.0;                 \n"
+        "    if (fragShape >= 0.0)          \n"
+        "    {                              \n"
+        "        float len = length(fragTexCoord); \n"
+        "        d = len - 1.0;             \n"
+        "        if (fragShape > 0.0) d = max(d, fragShape - len); \n"
+        "    }                              \n"
+        "    else                           \n"
+        "    {                              \n"
+        "        vec2 q = fragTexCoord;     \n"
+        "        d = length(max(q, 0.0)) + min(max(q.x, q.y), 0.0) - 1.0; \n"
+        "    }                              \n"
+        "    float pixel = max(length(vec2(dFdx(d), dFdy(d))), 0.000001); \n"
+        "    finalColor = vec4(fragColor.rgb, fragColor.a*clamp(0.5 - d/pixel, 0.0, 1.0)); \n"
+        "}                                  \n";
+
+        unsigned int id = rlLoadShaderCode(vsCode, fsCode);
+
+        // NOTE: Shader loading failure returns the default shader
+        if ((id == 0) || (id == rlGetShaderIdDefault()))
+        {
+            TRACELOG(LOG_WARNING, "SHAPES: Failed to load signed distance shader, shapes will be tessellated");
+            shapesShaderFailed = true;
+            return false;
+        }
+
+        for (int i = 0; i < RL_MAX_SHADER_LOCATIONS; i++) shapesShaderLocs[i] = -1;
+        shapesShaderLocs[RL_SHADER_LOC_VERTEX_POSITION] = rlGetLocationAttrib(id, "vertexPosition");
+        shapesShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01] = rlGetLocationAttrib(id, "vertexTexCoord");
+        shapesShaderLocs[RL_SHADER_LOC_VERTEX_COLOR] = rlGetLocationAttrib(id, "vertexColor");
+        shapesShaderLocs[RL_SHADER_LOC_MATRIX_MVP] = rlGetLocationUniform(id, "mvp");
+
+        shapesShaderId = id;
+    }
+
+    rlSetShader(shapesShaderId, shapesShaderLocs);
+
+    return true;
+}
+
+// End signed distance shapes drawing (restore default shader)
+static void EndShapesSDF(void)
+{
+    rlSetShader(rlGetShaderIdDefault(), rlGetShaderLocsDefault());
+}
+
+// Add signed distance shape quad, screen rectangle (x0, y0)-(x1, y1) with shape coordinates (u0, v0)-(u1, v1) at its corners
+// NOTE: Shape parameter is passed in vertex z: >= 0 for circles and rings (inner/outer radius ratio),
+// < 0 for rounded rectangle quadrants. Required rlBegin(RL_QUADS) to be called before
+static void DrawQuadSDF(float x0, float y0, float x1, float y1, float u0, float v0, float u1, float v1, float shape, Color color)
+{
+    rlColor4ub(color.r, color.g, color.b, color.a);
+
+    rlTexCoord2f(u0, v0);
+    rlVertex3f(x0, y0, shape);
+
+    rlTexCoord2f(u0, v1);
+    rlVertex3f(x0, y1, shape);
+
+    rlTexCoord2f(u1, v1);
+    rlVertex3f(x1, y1, shape);
+
+    rlTexCoord2f(u1, v0);
+    rlVertex3f(x1, y0, shape);
+}
+
+// Add signed distance ring quad (circle if innerRadius is 0), with one pixel margin for antialiasing
+static void DrawRingSDF(Vector2 center, float innerRadius, float outerRadius, Color color)
+{
+    float extent = outerRadius + 1.0f;
+    float uv = extent/outerRadius;
+
+    DrawQuadSDF(center.x - extent, center.y - extent, center.x + extent, center.y + extent, -uv, -uv, uv, uv, innerRadius/outerRadius, color);
+}
+
+// Unload signed distance shapes shader
+// NOTE: Called on CloseWindow(), before rlgl is de-initialized
+void UnloadShapesShader(void)
+{
+    if (shapesShaderId > 0) rlUnloadShaderProgram(shapesShaderId);
+
+    shapesShaderId = 0;
+    shapesShaderFailed = false;
+}
+
 #endif      // SUPPORT_MODULE_RSHAPES
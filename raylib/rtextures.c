@@ -73,11 +73,13 @@
 
 #include "utils.h"              // Required for: TRACELOG()
 #include "rlgl.h"               // OpenGL abstraction layer to OpenGL 1.1, 3.3 or ES2
+#include "raymath.h"            // Required for: MatrixMultiply() [Used in DrawSprites()]
 
 #include <stdlib.h>             // Required for: malloc(), free()
 #include <string.h>             // Required for: strlen() [Used in ImageTextEx()], strcmp() [Used in LoadImageFromMemory()]
-#include <math.h>               // Required for: fabsf() [Used in DrawTextureRec()]
+#include <math.h>               // Required for: fabsf() [Used in DrawTextureRec()], fminf(), fmaxf()
 #include <stdio.h>              // Required for: sprintf() [Used in ExportImageAsCode()]
+#include <stddef.h>             // Required for: offsetof() [Used in DrawSprites()]
 
 // Support only desired texture formats on stb_image
 #if !defined(SUPPORT_FILEFORMAT_BMP)
@@ -195,6 +197,18 @@
 #define STB_IMAGE_RESIZE_IMPLEMENTATION
 #include "external/stb_image_resize.h"  // Required for: stbir_resize_uint8() [ImageResize()]
 
+#if defined(__GNUC__) // stb_rect_pack setup functions are not used here, static ones would warn
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-function"
+#endif
+#define STBRP_STATIC
+#define STB_RECT_PACK_IMPLEMENTATION
+#include "external/stb_rect_pack.h"     // Required for: stbrp_pack_rects() [BuildTextureAtlas()]
+
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
@@ -202,6 +216,10 @@
     #define PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD  50    // Threshold over 255 to set alpha as 0
 #endif
 
+#ifndef MAX_TEXTURE_ATLAS_SIZE
+    #define MAX_TEXTURE_ATLAS_SIZE      8192        // Maximum texture atlas width/height: BuildTextureAtlas()
+#endif
+
 #ifndef GAUSSIAN_BLUR_ITERATIONS
     #define GAUSSIAN_BLUR_ITERATIONS  4    // Number of box blur iterations to approximate gaussian blur
 #endif
@@ -209,12 +227,37 @@
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Sprite instance attributes, as uploaded to the GPU by DrawSprites()
+typedef struct SpriteBatchInstance {
+    float dest[4];              // Destination rectangle: x, y, width, height
+    float texcoords[4];         // Texture coordinates: u0, v0, u1, v1 (flips already applied)
+    float transform[4];         // Rotation origin x, y and rotation cos, sin
+    unsigned char color[4];     // Tint color
+} SpriteBatchInstance;
+
+// Sprite sort key, index is used to keep the sort stable
+typedef struct SpriteBatchKey {
+    unsigned int textureId;
+    int index;
+} SpriteBatchKey;
+
+// Sprite batch GPU resources and scratch memory, loaded on first DrawSprites() call
+typedef struct SpriteBatch {
+    bool loaded;                // Load attempted (shader/buffers could have failed)
+    unsigned int shaderId;      // Instancing shader program id (0 if not available)
+    int locs[6];                // Shader locations: corner, dest, texcoords, transform, color attributes, mvp uniform
+    unsigned int vaoId;         // Vertex array with quad corners and instance attributes
+    unsigned int quadVboId;     // Unit quad corners (2 triangles)
+    unsigned int instanceVboId; // Instance attributes, reloaded when capacity grows
+    int capacity;               // Instances that fit in instances/keys and instanceVboId
+    SpriteBatchInstance *instances;
+    SpriteBatchKey *keys;
+} SpriteBatch;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-// It's lonely here...
+static SpriteBatch spriteBatch = { 0 };     // Sprite batch used by DrawSprites()
 
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by text)
@@ -225,6 +268,15 @@
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 static Vector4 *LoadImageDataNormalized(Image image);       // Load pixel data from image as Vector4 array (float normalized)
+static int CompareSpriteBatchKeys(const void *a, const void *b);    // Sprite keys comparison, by texture and then by index
+static void LoadSpriteBatch(void);                          // Load sprite batch shader and buffers (if instancing is supported)
+void UnloadSpriteBatch(void);                               // Unload sprite batch shader, buffers and scratch memory
+
+#if defined(SUPPORT_DRAW_CULLING)
+extern bool CheckDrawCulling(float minX, float minY, float maxX, float maxY);   // [Module: core] Check if 2D primitive bounds are outside the visible area
+#else
+    #define CheckDrawCulling(minX, minY, maxX, maxY) false
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -3381,6 +3433,144 @@ void UnloadRenderTexture(RenderTexture2D target)
     }
 }
 
+// Register an image into texture atlas (image data is copied), returns image index in atlas
+// NOTE: Atlas rectangles are only valid after BuildTextureAtlas()
+int AddTextureAtlasImage(TextureAtlas *atlas, Image image)
+{
+    if ((image.data == NULL) || (image.width == 0) || (image.height == 0))
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: Atlas image not valid, not added");
+        return -1;
+    }
+
+    Image *images = (Image *)RL_REALLOC(atlas->images, (atlas->imageCount + 1)*sizeof(Image));
+    Rectangle *recs = (Rectangle *)RL_REALLOC(atlas->recs, (atlas->imageCount + 1)*sizeof(Rectangle));
+
+    if (images != NULL) atlas->images = images;
+    if (recs != NULL) atlas->recs = recs;
+    if ((images == NULL) || (recs == NULL))
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: Failed to allocate atlas image");
+        return -1;
+    }
+
+    // Images are kept as R8G8B8A8 so BuildTextureAtlas() can copy them row by row
+    Image copy = ImageCopy(image);
+    ImageFormat(&copy, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+    atlas->images[atlas->imageCount] = copy;
+    atlas->recs[atlas->imageCount] = (Rectangle){ 0, 0, (float)copy.width, (float)copy.height };
+
+    return atlas->imageCount++;
+}
+
+// Pack registered images into a single texture (previous atlas texture is unloaded)
+// NOTE: Atlas starts at the smallest power-of-two size fitting all images area and it's grown
+// until all images fit or MAX_TEXTURE_ATLAS_SIZE is reached, padding pixels around every image are left transparent
+bool BuildTextureAtlas(TextureAtlas *atlas, int padding)
+{
+    if (atlas->imageCount == 0) return false;
+
+    stbrp_rect *rects = (stbrp_rect *)RL_MALLOC(atlas->imageCount*sizeof(stbrp_rect));
+
+    int area = 0;
+    int minWidth = 1;
+    int minHeight = 1;
+    for (int i = 0; i < atlas->imageCount; i++)
+    {
+        rects[i].id = i;
+        rects[i].w = atlas->images[i].width + 2*padding;
+        rects[i].h = atlas->images[i].height + 2*padding;
+
+        area += rects[i].w*rects[i].h;
+        if (rects[i].w > minWidth) minWidth = rects[i].w;
+        if (rects[i].h > minHeight) minHeight = rects[i].h;
+    }
+
+    int width = 1;
+    int height = 1;
+    while ((width < minWidth) || (width*width < area)) width *= 2;
+    while (height < minHeight) height *= 2;
+    if (height < width) height = width;
+
+    bool packed = false;
+    stbrp_node *nodes = NULL;
+
+    while (!packed && (width <= MAX_TEXTURE_ATLAS_SIZE) && (height <= MAX_TEXTURE_ATLAS_SIZE))
+    {
+        stbrp_context context = { 0 };
+        nodes = (stbrp_node *)RL_REALLOC(nodes, width*sizeof(stbrp_node));
+
+        stbrp_init_target(&context, width, height, nodes, width);
+        packed = (stbrp_pack_rects(&context, rects, atlas->imageCount) == 1);
+
+        // Grow the smaller dimension, atlas stays square or twice as wide as tall
+        if (!packed)
+        {
+            if (width <= height) width *= 2;
+            else height *= 2;
+        }
+    }
+
+    RL_FREE(nodes);
+
+    if (!packed)
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: Failed to pack %i images into a %ix%i atlas", atlas->imageCount, MAX_TEXTURE_ATLAS_SIZE, MAX_TEXTURE_ATLAS_SIZE);
+        RL_FREE(rects);
+        return false;
+    }
+
+    // Copy registered images into atlas image
+    Image atlasImage = GenImageColor(width, height, BLANK);
+
+    for (int i = 0; i < atlas->imageCount; i++)
+    {
+        const Image *image = &atlas->images[rects[i].id];
+        int x = rects[i].x + padding;
+        int y = rects[i].y + padding;
+
+        for (int row = 0; row < image->height; row++)
+        {
+            memcpy((unsigned char *)atlasImage.data + ((y + row)*width + x)*4, (unsigned char *)image->data + row*image->width*4, image->width*4);
+        }
+
+        atlas->recs[rects[i].id] = (Rectangle){ (float)x, (float)y, (float)image->width, (float)image->height };
+    }
+
+    RL_FREE(rects);
+
+    if (atlas->texture.id > 0) UnloadTexture(atlas->texture);
+    atlas->texture = LoadTextureFromImage(atlasImage);
+    UnloadImage(atlasImage);
+
+    if (atlas->texture.id == 0) return false;
+
+    TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Atlas built successfully (%i images, %ix%i)", atlas->texture.id, atlas->imageCount, width, height);
+
+    return true;
+}
+
+// Get atlas texture rectangle for a source rectangle of a registered image
+// NOTE: Negative source width/height (flipped drawing) are kept
+Rectangle GetTextureAtlasRec(TextureAtlas atlas, int index, Rectangle source)
+{
+    if ((index < 0) || (index >= atlas.imageCount)) return source;
+
+    return (Rectangle){ atlas.recs[index].x + source.x, atlas.recs[index].y + source.y, source.width, source.height };
+}
+
+// Unload texture atlas texture and registered images
+void UnloadTextureAtlas(TextureAtlas atlas)
+{
+    for (int i = 0; i < atlas.imageCount; i++) UnloadImage(atlas.images[i]);
+
+    RL_FREE(atlas.images);
+    RL_FREE(atlas.recs);
+
+    if (atlas.texture.id > 0) UnloadTexture(atlas.texture);
+}
+
 // Update GPU texture with new data
 // NOTE: pixels data must match texture.format
 void UpdateTexture(Texture2D texture, const void *pixels)
@@ -3588,6 +3778,9 @@ void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2
             bottomRight.y = y + (dx + dest.width)*sinRotation + (dy + dest.height)*cosRotation;
         }
 
+        if (CheckDrawCulling(fminf(fminf(topLeft.x, topRight.x), fminf(bottomLeft.x, bottomRight.x)), fminf(fminf(topLeft.y, topRight.y), fminf(bottomLeft.y, bottomRight.y)),
+            fmaxf(fmaxf(topLeft.x, topRight.x), fmaxf(bottomLeft.x, bottomRight.x)), fmaxf(fmaxf(topLeft.y, topRight.y), fmaxf(bottomLeft.y, bottomRight.y)))) return;
+
         rlSetTexture(texture.id);
         rlBegin(RL_QUADS);
 
@@ -3856,6 +4049,195 @@ void DrawTextureNPatch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle dest,
     }
 }
 
+// Draw an array of sprites (textured quads with source/dest rectangles, origin and rotation, like DrawTexturePro())
+// NOTE: Sprites are sorted by texture (sprites sharing a texture keep their relative order) and every
+// texture group is drawn with a single instanced draw call, when instancing is not available every
+// sprite is drawn with DrawTexturePro() in the same sorted order
+// NOTE: While recording a command buffer sprites are drawn with DrawTexturePro() in the given order
+void DrawSprites(const SpriteInstance *sprites, int count)
+{
+    if ((sprites == NULL) || (count <= 0)) return;
+
+    PROFILE_BEGIN("DrawSprites");
+
+    // Command buffers only record vertices and can be recorded on any thread: no GL calls (instance
+    // buffer upload, instanced draws) and no shared sprite batch scratch memory here
+    if (rlIsCommandBufferRecording())
+    {
+        for (int i = 0; i < count; i++)
+        {
+            const SpriteInstance *sprite = &sprites[i];
+            if (sprite->texture.id > 0) DrawTexturePro(sprite->texture, sprite->source, sprite->dest, sprite->origin, sprite->rotation, sprite->tint);
+        }
+
+        PROFILE_END();
+        return;
+    }
+
+    if (!spriteBatch.loaded) LoadSpriteBatch();
+
+    // Grow scratch memory (and instances buffer) if required
+    if (count > spriteBatch.capacity)
+    {
+        int capacity = (spriteBatch.capacity > 0)? spriteBatch.capacity : 1024;
+        while (capacity < count) capacity *= 2;
+
+        SpriteBatchInstance *instances = (SpriteBatchInstance *)RL_REALLOC(spriteBatch.instances, capacity*sizeof(SpriteBatchInstance));
+        SpriteBatchKey *keys = (SpriteBatchKey *)RL_REALLOC(spriteBatch.keys, capacity*sizeof(SpriteBatchKey));
+
+        if (instances != NULL) spriteBatch.instances = instances;
+        if (keys != NULL) spriteBatch.keys = keys;
+
+        if ((instances == NULL) || (keys == NULL))
+        {
+            TRACELOG(LOG_WARNING, "TEXTURE: Failed to allocate sprite batch memory for %i sprites", count);
+            PROFILE_END();
+            return;
+        }
+
+        if (spriteBatch.shaderId > 0)
+        {
+            if (spriteBatch.instanceVboId > 0) rlUnloadVertexBuffer(spriteBatch.instanceVboId);
+            spriteBatch.instanceVboId = rlLoadVertexBuffer(NULL, capacity*sizeof(SpriteBatchInstance), true);
+        }
+
+        spriteBatch.capacity = capacity;
+    }
+
+    // Sort sprites by texture, invalid textures (and sprites outside the visible area) are skipped
+    // NOTE: Without instancing, sprites are culled by DrawTexturePro()
+    int validCount = 0;
+    for (int i = 0; i < count; i++)
+    {
+        const SpriteInstance *sprite = &sprites[i];
+        if (sprite->texture.id == 0) continue;
+
+        if (spriteBatch.shaderId > 0)
+        {
+            // Rotated sprites are bounded by the circle their corners describe around the pivot
+            float minX = -sprite->origin.x, maxX = sprite->dest.width - sprite->origin.x;
+            float minY = -sprite->origin.y, maxY = sprite->dest.height - sprite->origin.y;
+
+            if (sprite->rotation != 0.0f)
+            {
+                float extentX = fmaxf(fabsf(minX), fabsf(maxX));
+                float extentY = fmaxf(fabsf(minY), fabsf(maxY));
+                float radius = sqrtf(extentX*extentX + extentY*extentY);
+                minX = -radius; maxX = radius;
+                minY = -radius; maxY = radius;
+            }
+
+            if (CheckDrawCulling(sprite->dest.x + fminf(minX, maxX), sprite->dest.y + fminf(minY, maxY),
+                sprite->dest.x + fmaxf(minX, maxX), sprite->dest.y + fmaxf(minY, maxY))) continue;
+        }
+
+        spriteBatch.keys[validCount++] = (SpriteBatchKey){ sprite->texture.id, i };
+    }
+
+    qsort(spriteBatch.keys, validCount, sizeof(SpriteBatchKey), CompareSpriteBatchKeys);
+
+    if (spriteBatch.shaderId == 0)
+    {
+        for (int i = 0; i < validCount; i++)
+        {
+            const SpriteInstance *sprite = &sprites[spriteBatch.keys[i].index];
+            DrawTexturePro(sprite->texture, sprite->source, sprite->dest, sprite->origin, sprite->rotation, sprite->tint);
+        }
+
+        PROFILE_END();
+        return;
+    }
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    // Fill instance attributes in sorted order
+    for (int i = 0; i < validCount; i++)
+    {
+        const SpriteInstance *sprite = &sprites[spriteBatch.keys[i].index];
+        SpriteBatchInstance *instance = &spriteBatch.instances[i];
+
+        float width = (float)sprite->texture.width;
+        float height = (float)sprite->texture.height;
+        Rectangle source = sprite->source;
+
+        // Negative source width/height flip the sprite, same as DrawTexturePro()
+        float u0 = source.x/width;
+        float u1 = (source.x + source.width)/width;
+        float v0 = source.y/height;
+        float v1 = (source.y + source.height)/height;
+
+        if (source.width < 0) { u0 = (source.x - source.width)/width; u1 = source.x/width; }
+        if (source.height < 0) { v0 = (source.y - source.height)/height; v1 = source.y/height; }
+
+        float angle = sprite->rotation*DEG2RAD;
+
+        instance->dest[0] = sprite->dest.x;
+        instance->dest[1] = sprite->dest.y;
+        instance->dest[2] = sprite->dest.width;
+        instance->dest[3] = sprite->dest.height;
+        instance->texcoords[0] = u0;
+        instance->texcoords[1] = v0;
+        instance->texcoords[2] = u1;
+        instance->texcoords[3] = v1;
+        instance->transform[0] = sprite->origin.x;
+        instance->transform[1] = sprite->origin.y;
+        instance->transform[2] = (sprite->rotation == 0.0f)? 1.0f : cosf(angle);
+        instance->transform[3] = (sprite->rotation == 0.0f)? 0.0f : sinf(angle);
+        instance->color[0] = sprite->tint.r;
+        instance->color[1] = sprite->tint.g;
+        instance->color[2] = sprite->tint.b;
+        instance->color[3] = sprite->tint.a;
+    }
+
+    // Draw everything already in the internal render batch before sprites
+    rlDrawRenderBatchActive();
+
+    // NOTE: Orphaned first, several calls per frame would otherwise stall until the previous draw read the buffer
+    if (validCount > 0)
+    {
+        rlOrphanVertexBuffer(spriteBatch.instanceVboId, spriteBatch.capacity*sizeof(SpriteBatchInstance));
+        rlUpdateVertexBuffer(spriteBatch.instanceVboId, spriteBatch.instances, validCount*sizeof(SpriteBatchInstance), 0);
+    }
+
+    // NOTE: Same transform pipeline as the internal render batch: accumulated transform (rlPushMatrix()/rlTranslatef()...),
+    // current modelview and projection, stereo rendering is not supported
+    Matrix matModelView = MatrixMultiply(rlGetMatrixTransform(), rlGetMatrixModelview());
+    Matrix matModelViewProjection = MatrixMultiply(matModelView, rlGetMatrixProjection());
+
+    rlEnableShader(spriteBatch.shaderId);
+    rlSetUniformMatrix(spriteBatch.locs[5], matModelViewProjection);
+
+    rlEnableVertexArray(spriteBatch.vaoId);
+    rlEnableVertexBuffer(spriteBatch.instanceVboId);
+    rlActiveTextureSlot(0);
+
+    // One instanced draw call per texture group, instance attributes are pointed at the group first instance
+    for (int first = 0; first < validCount; )
+    {
+        unsigned int textureId = spriteBatch.keys[first].textureId;
+        int last = first + 1;
+        while ((last < validCount) && (spriteBatch.keys[last].textureId == textureId)) last++;
+
+        size_t offset = first*sizeof(SpriteBatchInstance);
+        rlSetVertexAttribute(spriteBatch.locs[1], 4, RL_FLOAT, false, sizeof(SpriteBatchInstance), (void *)(offset + offsetof(SpriteBatchInstance, dest)));
+        rlSetVertexAttribute(spriteBatch.locs[2], 4, RL_FLOAT, false, sizeof(SpriteBatchInstance), (void *)(offset + offsetof(SpriteBatchInstance, texcoords)));
+        rlSetVertexAttribute(spriteBatch.locs[3], 4, RL_FLOAT, false, sizeof(SpriteBatchInstance), (void *)(offset + offsetof(SpriteBatchInstance, transform)));
+        rlSetVertexAttribute(spriteBatch.locs[4], 4, RL_UNSIGNED_BYTE, true, sizeof(SpriteBatchInstance), (void *)(offset + offsetof(SpriteBatchInstance, color)));
+
+        rlEnableTexture(textureId);
+        rlDrawVertexArrayInstanced(0, 6, last - first);
+
+        first = last;
+    }
+
+    rlDisableTexture();
+    rlDisableVertexBuffer();
+    rlDisableVertexArray();
+    rlDisableShader();
+#endif
+
+    PROFILE_END();
+}
+
 // Get color with alpha applied, alpha goes from 0.0f to 1.0f
 Color Fade(Color color, float alpha)
 {
@@ -4470,4 +4852,111 @@ static Vector4 *LoadImageDataNormalized(Image image)
     return pixels;
 }
 
+// Sprite keys comparison, by texture and then by index
+static int CompareSpriteBatchKeys(const void *a, const void *b)
+{
+    const SpriteBatchKey *keyA = (const SpriteBatchKey *)a;
+    const SpriteBatchKey *keyB = (const SpriteBatchKey *)b;
+
+    if (keyA->textureId != keyB->textureId) return (keyA->textureId < keyB->textureId)? -1 : 1;
+    return (keyA->index < keyB->index)? -1 : ((keyA->index > keyB->index)? 1 : 0);
+}
+
+// Load sprite batch shader and buffers (if instancing is supported)
+// NOTE: Only OpenGL 3.3+ is supported, otherwise shaderId stays 0 and DrawSprites() falls back to DrawTexturePro()
+static void LoadSpriteBatch(void)
+{
+    spriteBatch.loaded = true;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    const char *vsCode =
+        "#version 330                       \n"
+        "in vec2 vertexCorner;              \n"
+        "in vec4 instanceDest;              \n"
+        "in vec4 instanceTexCoords;         \n"
+        "in vec4 instanceTransform;         \n"
+        "in vec4 instanceColor;             \n"
+        "out vec2 fragTexCoord;             \n"
+        "out vec4 fragColor;                \n"
+        "uniform mat4 mvp;                  \n"
+        "void main()                        \n"
+        "{                                  \n"
+        "    vec2 local = vertexCorner*instanceDest.zw - instanceTransform.xy;  \n"
+        "    vec2 position = instanceDest.xy + vec2(local.x*instanceTransform.z - local.y*instanceTransform.w, local.x*instanceTransform.w + local.y*instanceTransform.z); \n"
+        "    fragTexCoord = mix(instanceTexCoords.xy, instanceTexCoords.zw, vertexCorner); \n"
+        "    fragColor = instanceColor;     \n"
+        "    gl_Position = mvp*vec4(position, 0.0, 1.0); \n"
+        "}                                  \n";
+
+    const char *fsCode =
+        "#version 330                       \n"
+        "in vec2 fragTexCoord;              \n"
+        "in vec4 fragColor;                 \n"
+        "out vec4 finalColor;               \n"
+        "uniform sampler2D texture0;        \n"
+        "void main()                        \n"
+        "{                                  \n"
+        "    finalColor = texture(texture0, fragTexCoord)*fragColor; \n"
+        "}                                  \n";
+
+    unsigned int shaderId = rlLoadShaderCode(vsCode, fsCode);
+
+    // NOTE: Shader loading failure returns the default shader, it can't be used for instancing
+    if ((shaderId == 0) || (shaderId == rlGetShaderIdDefault()))
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: Failed to load sprite batch shader, sprites will be drawn one by one");
+        return;
+    }
+
+    spriteBatch.locs[0] = rlGetLocationAttrib(shaderId, "vertexCorner");
+    spriteBatch.locs[1] = rlGetLocationAttrib(shaderId, "instanceDest");
+    spriteBatch.locs[2] = rlGetLocationAttrib(shaderId, "instanceTexCoords");
+    spriteBatch.locs[3] = rlGetLocationAttrib(shaderId, "instanceTransform");
+    spriteBatch.locs[4] = rlGetLocationAttrib(shaderId, "instanceColor");
+    spriteBatch.locs[5] = rlGetLocationUniform(shaderId, "mvp");
+
+    // Unit quad, same winding as DrawTexturePro(): top-left, bottom-left, bottom-right, top-right
+    const float corners[12] = { 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f, 0.0f };
+
+    spriteBatch.vaoId = rlLoadVertexArray();
+    rlEnableVertexArray(spriteBatch.vaoId);
+
+    spriteBatch.quadVboId = rlLoadVertexBuffer(corners, sizeof(corners), false);
+    rlSetVertexAttribute(spriteBatch.locs[0], 2, RL_FLOAT, false, 0, 0);
+    rlEnableVertexAttribute(spriteBatch.locs[0]);
+
+    // Instance attributes, actual buffer pointers are set before every draw call
+    for (int i = 1; i < 5; i++)
+    {
+        rlEnableVertexAttribute(spriteBatch.locs[i]);
+        rlSetVertexAttributeDivisor(spriteBatch.locs[i], 1);
+    }
+
+    rlDisableVertexBuffer();
+    rlDisableVertexArray();
+
+    spriteBatch.shaderId = shaderId;
+
+    TRACELOG(LOG_INFO, "TEXTURE: [SHADER ID %i] Sprite batch loaded successfully (instanced)", shaderId);
+#endif
+}
+
+// Unload sprite batch shader, buffers and scratch memory
+// NOTE: Called on CloseWindow(), before rlgl is de-initialized
+void UnloadSpriteBatch(void)
+{
+    if (spriteBatch.shaderId > 0)
+    {
+        rlUnloadVertexArray(spriteBatch.vaoId);
+        rlUnloadVertexBuffer(spriteBatch.quadVboId);
+        if (spriteBatch.instanceVboId > 0) rlUnloadVertexBuffer(spriteBatch.instanceVboId);
+        rlUnloadShaderProgram(spriteBatch.shaderId);
+    }
+
+    RL_FREE(spriteBatch.instances);
+    RL_FREE(spriteBatch.keys);
+
+    spriteBatch = (SpriteBatch){ 0 };
+}
+
 #endif      // SUPPORT_MODULE_RTEXTURES
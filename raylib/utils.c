@@ -8,6 +8,11 @@
 *       Show TraceLog() output messages
 *       NOTE: By default LOG_DEBUG traces not shown
 *
+*   #define SUPPORT_PROFILER
+*       Record BeginProfileZone()/EndProfileZone() zones in lock-free per-thread ring buffers
+*       NOTE: Every thread keeps its last MAX_PROFILE_ZONES completed zones, rings come from a static
+*       pool of MAX_PROFILE_THREADS and are recycled when their thread exits
+*
 *
 *   LICENSE: zlib/libpng
 *
@@ -30,6 +35,11 @@
 *
 **********************************************************************************************/
 
+#if defined(__linux__) && (_POSIX_C_SOURCE < 199309L)
+    #undef _POSIX_C_SOURCE
+    #define _POSIX_C_SOURCE 199309L     // Required for: CLOCK_MONOTONIC if compiled with c99 without gnu ext.
+#endif
+
 #include "raylib.h"                     // WARNING: Required for: LogType enum
 
 // Check if config flags have been externally provided on compilation line
@@ -48,7 +58,23 @@
 #include <stdlib.h>                     // Required for: exit()
 #include <stdio.h>                      // Required for: FILE, fopen(), fseek(), ftell(), fread(), fwrite(), fprintf(), vprintf(), fclose()
 #include <stdarg.h>                     // Required for: va_list, va_start(), va_end()
-#include <string.h>                     // Required for: strcpy(), strcat()
+#include <string.h>                     // Required for: strcpy(), strcat(), strlen()
+
+#if defined(SUPPORT_PROFILER)
+    #if defined(_WIN32)
+    __declspec(dllimport) int __stdcall QueryPerformanceCounter(unsigned long long *lpPerformanceCount);
+    __declspec(dllimport) int __stdcall QueryPerformanceFrequency(unsigned long long *lpFrequency);
+    __declspec(dllimport) unsigned long __stdcall FlsAlloc(void (__stdcall *lpCallback)(void *lpFlsData));
+    __declspec(dllimport) int __stdcall FlsSetValue(unsigned long dwFlsIndex, void *lpFlsData);
+    #else
+        #include <time.h>               // Required for: clock_gettime()
+        #include <pthread.h>            // Required for: pthread_key_create(), pthread_setspecific()
+    #endif
+
+    #if defined(_MSC_VER)
+        #include <intrin.h>             // Required for: _InterlockedCompareExchange(), _InterlockedIncrement()
+    #endif
+#endif
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
@@ -56,6 +82,51 @@
 #ifndef MAX_TRACELOG_MSG_LENGTH
     #define MAX_TRACELOG_MSG_LENGTH     256         // Max length of one trace-log message
 #endif
+#ifndef MAX_PROFILE_ZONES
+    #define MAX_PROFILE_ZONES          8192         // Max completed profile zones kept per thread (power of two)
+#endif
+#ifndef MAX_PROFILE_ZONE_DEPTH
+    #define MAX_PROFILE_ZONE_DEPTH       64         // Max nested open profile zones per thread
+#endif
+#ifndef MAX_PROFILE_THREADS
+    #define MAX_PROFILE_THREADS          16         // Max threads recording profile zones at the same time
+#endif
+
+#if defined(SUPPORT_PROFILER)
+    // NOTE: Ring counters are written by their owner thread only and read by any thread,
+    // publishing them with release/acquire is enough to read finished zones without locks
+    #if defined(_MSC_VER)
+        #define PROFILER_THREAD_LOCAL __declspec(thread)
+        #define PROFILER_LOAD_ACQUIRE(ptr) (*(volatile unsigned int *)(ptr))        // NOTE: MSVC volatile has acquire/release semantics
+        #define PROFILER_STORE_RELEASE(ptr, value) (*(volatile unsigned int *)(ptr) = (value))
+        #define PROFILER_FENCE_ACQUIRE() _ReadWriteBarrier()
+        #define PROFILER_INCREMENT(ptr) ((unsigned int)_InterlockedIncrement((volatile long *)(ptr)))
+        #define PROFILER_CAS(ptr, expected, desired) (_InterlockedCompareExchange((volatile long *)(ptr), (long)(desired), (long)(expected)) == (long)(expected))
+    #else
+        #define PROFILER_THREAD_LOCAL __thread
+        #define PROFILER_LOAD_ACQUIRE(ptr) __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+        #define PROFILER_STORE_RELEASE(ptr, value) __atomic_store_n((ptr), (value), __ATOMIC_RELEASE)
+        #define PROFILER_FENCE_ACQUIRE() __atomic_thread_fence(__ATOMIC_ACQUIRE)
+        #define PROFILER_INCREMENT(ptr) __atomic_add_fetch((ptr), 1, __ATOMIC_RELAXED)
+        #define PROFILER_CAS(ptr, expected, desired) __atomic_compare_exchange_n((ptr), &(expected), (desired), false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+    #endif
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+#if defined(SUPPORT_PROFILER)
+// Profiler data of one thread, claimed from the pool on its first zone and released when it exits
+// NOTE: A released ring keeps its zones (and written count) until the next owner overwrites them
+typedef struct ProfileThread {
+    ProfileZone zones[MAX_PROFILE_ZONES];   // Ring of completed zones, in end order
+    unsigned int written;                   // Completed zones ever written (only written by owner thread)
+    ProfileZone open[MAX_PROFILE_ZONE_DEPTH]; // Stack of open zones
+    unsigned int openCount;                 // Open zones count
+    unsigned int id;                        // Profiler thread id
+    unsigned int claimed;                   // Ring owned by a running thread
+} ProfileThread;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -68,6 +139,18 @@ static SaveFileDataCallback saveFileData = NULL;    // SaveFileText callback fun
 static LoadFileTextCallback loadFileText = NULL;    // LoadFileText callback function pointer
 static SaveFileTextCallback saveFileText = NULL;    // SaveFileText callback function pointer
 
+#if defined(SUPPORT_PROFILER)
+static ProfileThread profileThreads[MAX_PROFILE_THREADS] = { 0 };  // Profiler rings pool, no allocation on first zone
+static unsigned int profileThreadCount = 0;         // Profiler thread ids given so far
+static unsigned int profileExitState = 0;           // Thread exit hook state: 0 not created, 1 creating, 2 ready
+#if defined(_WIN32)
+static unsigned long profileExitKey = 0;            // Fiber local storage index calling ReleaseProfileThread()
+#else
+static pthread_key_t profileExitKey;                // Thread specific key calling ReleaseProfileThread()
+#endif
+static PROFILER_THREAD_LOCAL ProfileThread *profileThread = NULL;   // Profiler data of calling thread
+#endif
+
 //----------------------------------------------------------------------------------
 // Functions to set internal callbacks
 //----------------------------------------------------------------------------------
@@ -96,6 +179,15 @@ static fpos_t android_seek(void *cookie, fpos_t offset, int whence);
 static int android_close(void *cookie);
 #endif
 
+#if defined(SUPPORT_PROFILER)
+#if defined(_WIN32)
+static void __stdcall ReleaseProfileThread(void *data);     // Give the ring of an exiting thread back to the pool
+#else
+static void ReleaseProfileThread(void *data);               // Give the ring of an exiting thread back to the pool
+#endif
+static ProfileThread *ClaimProfileThread(void);             // Claim a free ring from the pool for the calling thread
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Utilities
 //----------------------------------------------------------------------------------
@@ -408,6 +500,184 @@ bool SaveFileText(const char *fileName, char *text)
     return success;
 }
 
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Profiler
+//----------------------------------------------------------------------------------
+
+// Get profiler clock time in nanoseconds (monotonic)
+unsigned long long GetProfileTime(void)
+{
+    unsigned long long time = 0;
+
+#if defined(SUPPORT_PROFILER)
+    #if defined(_WIN32)
+    unsigned long long counter = 0;
+    unsigned long long frequency = 1;
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+
+    // NOTE: Split to avoid overflowing counter*1000000000
+    time = (counter/frequency)*1000000000ULL + (counter%frequency)*1000000000ULL/frequency;
+    #else
+    struct timespec ts = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    time = (unsigned long long)ts.tv_sec*1000000000ULL + (unsigned long long)ts.tv_nsec;
+    #endif
+#endif
+
+    return time;
+}
+
+// Begin a named profiling zone on the calling thread
+void BeginProfileZone(const char *name)
+{
+#if defined(SUPPORT_PROFILER)
+    ProfileThread *thread = profileThread;
+
+    if (thread == NULL)
+    {
+        // First zone of this thread: claim a ring buffer
+        // NOTE: With more than MAX_PROFILE_THREADS threads recording, zones of the extra ones are dropped
+        thread = ClaimProfileThread();
+        if (thread == NULL) return;
+
+        profileThread = thread;
+    }
+
+    if (thread->openCount < MAX_PROFILE_ZONE_DEPTH)
+    {
+        ProfileZone *zone = &thread->open[thread->openCount];
+        zone->name = name;
+        zone->thread = thread->id;
+        zone->depth = thread->openCount;
+        zone->start = GetProfileTime();
+    }
+
+    // NOTE: Zones nested deeper than MAX_PROFILE_ZONE_DEPTH are counted but not recorded
+    thread->openCount++;
+#endif
+}
+
+// End the last zone begun on the calling thread
+void EndProfileZone(void)
+{
+#if defined(SUPPORT_PROFILER)
+    ProfileThread *thread = profileThread;
+    if ((thread == NULL) || (thread->openCount == 0)) return;
+
+    thread->openCount--;
+
+    if (thread->openCount < MAX_PROFILE_ZONE_DEPTH)
+    {
+        ProfileZone zone = thread->open[thread->openCount];
+        zone.end = GetProfileTime();
+
+        unsigned int written = thread->written;
+        thread->zones[written & (MAX_PROFILE_ZONES - 1)] = zone;
+        PROFILER_STORE_RELEASE(&thread->written, written + 1);
+    }
+#endif
+}
+
+// Get zones of all threads ended after since (newest first per thread), returns zones count
+// NOTE: Zones overwritten by their thread while being copied are discarded
+int GetProfileZones(ProfileZone *zones, int maxZones, unsigned long long since)
+{
+    int count = 0;
+
+#if defined(SUPPORT_PROFILER)
+    for (int t = 0; (t < MAX_PROFILE_THREADS) && (count < maxZones); t++)
+    {
+        ProfileThread *thread = &profileThreads[t];
+        unsigned int written = PROFILER_LOAD_ACQUIRE(&thread->written);
+        unsigned int first = (written > MAX_PROFILE_ZONES)? written - MAX_PROFILE_ZONES : 0;
+        int threadStart = count;
+
+        // Walk back from the newest zone, zones are stored in end order
+        unsigned int index = written;
+        while ((index > first) && (count < maxZones))
+        {
+            ProfileZone zone = thread->zones[(index - 1) & (MAX_PROFILE_ZONES - 1)];
+            if (zone.end <= since) break;
+
+            zones[count] = zone;
+            count++;
+            index--;
+        }
+
+        // Check the owner thread did not lap the copied zones meanwhile,
+        // the slot being written right now (index written) counts as overwritten
+        PROFILER_FENCE_ACQUIRE();
+        unsigned int rewritten = PROFILER_LOAD_ACQUIRE(&thread->written);
+        unsigned int valid = (rewritten + 1 > MAX_PROFILE_ZONES)? rewritten + 1 - MAX_PROFILE_ZONES : 0;
+
+        for (int i = threadStart; i < count; i++)
+        {
+            // zones[i] was copied from ring index written - 1 - (i - threadStart)
+            if ((written - 1 - (unsigned int)(i - threadStart)) < valid)
+            {
+                count = i;
+                break;
+            }
+        }
+    }
+#endif
+
+    return count;
+}
+
+// Export recorded zones as Chrome trace event JSON, returns true on success
+// NOTE: Open with chrome://tracing or https://ui.perfetto.dev, zone names are not escaped
+bool ExportProfileTrace(const char *fileName)
+{
+    bool success = false;
+
+#if defined(SUPPORT_PROFILER)
+    int maxZones = 0;
+    for (int t = 0; t < MAX_PROFILE_THREADS; t++)
+    {
+        unsigned int written = PROFILER_LOAD_ACQUIRE(&profileThreads[t].written);
+        maxZones += (written > MAX_PROFILE_ZONES)? MAX_PROFILE_ZONES : (int)written;
+    }
+
+    ProfileZone *zones = (ProfileZone *)RL_MALLOC((maxZones + 1)*sizeof(ProfileZone));
+    int zoneCount = GetProfileZones(zones, maxZones, 0);
+
+    // Make timestamps relative to the oldest zone, easier to read in trace viewers
+    unsigned long long origin = (zoneCount > 0)? zones[0].start : 0;
+    int bufferSize = 64;
+    for (int i = 0; i < zoneCount; i++)
+    {
+        if (zones[i].start < origin) origin = zones[i].start;
+        bufferSize += 128 + (int)strlen(zones[i].name);
+    }
+
+    char *text = (char *)RL_MALLOC(bufferSize);
+    int length = sprintf(text, "{\"traceEvents\":[");
+
+    for (int i = 0; i < zoneCount; i++)
+    {
+        length += sprintf(text + length, "%s\n{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u}",
+            (i > 0)? "," : "", zones[i].name, (double)(zones[i].start - origin)/1000.0,
+            (double)(zones[i].end - zones[i].start)/1000.0, zones[i].thread);
+    }
+
+    sprintf(text + length, "\n]}\n");
+
+    success = SaveFileText(fileName, text);
+
+    RL_FREE(text);
+    RL_FREE(zones);
+
+    if (success) TRACELOG(LOG_INFO, "PROFILER: [%s] Trace exported successfully (%i zones)", fileName, zoneCount);
+    else TRACELOG(LOG_WARNING, "PROFILER: [%s] Failed to export trace", fileName);
+#else
+    TRACELOG(LOG_WARNING, "PROFILER: Profiler not supported, enable SUPPORT_PROFILER");
+#endif
+
+    return success;
+}
+
 #if defined(PLATFORM_ANDROID)
 // Initialize asset manager from android app
 void InitAssetManager(AAssetManager *manager, const char *dataPath)
@@ -478,3 +748,57 @@ static int android_close(void *cookie)
     return 0;
 }
 #endif  // PLATFORM_ANDROID
+
+#if defined(SUPPORT_PROFILER)
+// Give the ring of an exiting thread back to the pool
+#if defined(_WIN32)
+static void __stdcall ReleaseProfileThread(void *data)
+#else
+static void ReleaseProfileThread(void *data)
+#endif
+{
+    ProfileThread *thread = (ProfileThread *)data;
+    if (thread != NULL) PROFILER_STORE_RELEASE(&thread->claimed, 0);
+}
+
+// Claim a free ring from the pool for the calling thread, returns NULL if all are in use
+// NOTE: Only atomics, so the first zone of a real-time thread (audio callback) never allocates
+static ProfileThread *ClaimProfileThread(void)
+{
+    // Create the thread exit hook once, whichever thread records the first zone
+    if (PROFILER_LOAD_ACQUIRE(&profileExitState) != 2)
+    {
+        unsigned int expected = 0;
+        if (PROFILER_CAS(&profileExitState, expected, 1))
+        {
+#if defined(_WIN32)
+            profileExitKey = FlsAlloc(ReleaseProfileThread);
+#else
+            pthread_key_create(&profileExitKey, ReleaseProfileThread);
+#endif
+            PROFILER_STORE_RELEASE(&profileExitState, 2);
+        }
+        else while (PROFILER_LOAD_ACQUIRE(&profileExitState) != 2) { }
+    }
+
+    for (int i = 0; i < MAX_PROFILE_THREADS; i++)
+    {
+        ProfileThread *thread = &profileThreads[i];
+        unsigned int expected = 0;
+
+        if ((PROFILER_LOAD_ACQUIRE(&thread->claimed) == 0) && PROFILER_CAS(&thread->claimed, expected, 1))
+        {
+            thread->openCount = 0;
+            thread->id = PROFILER_INCREMENT(&profileThreadCount);
+#if defined(_WIN32)
+            FlsSetValue(profileExitKey, thread);
+#else
+            pthread_setspecific(profileExitKey, thread);
+#endif
+            return thread;
+        }
+    }
+
+    return NULL;
+}
+#endif  // SUPPORT_PROFILER
@@ -45,6 +45,14 @@
     #define TRACELOGD(...) (void)0
 #endif
 
+#if defined(SUPPORT_PROFILER)
+    #define PROFILE_BEGIN(name) BeginProfileZone(name)
+    #define PROFILE_END() EndProfileZone()
+#else
+    #define PROFILE_BEGIN(name) (void)0
+    #define PROFILE_END() (void)0
+#endif
+
 //----------------------------------------------------------------------------------
 // Some basic Defines
 //----------------------------------------------------------------------------------